@@ -19,7 +19,7 @@ namespace Library
 
 	Entity* Action::GetEntity() const
 	{
-		assert(GetParent()->Is(Entity::TypeIdClass()));
+		assert(GetParent()->Is<Entity>());
 
 		return static_cast<Entity*>(GetParent());
 	}
@@ -45,14 +45,28 @@ namespace Library
 		};
 	}
 
-	Datum* Action::Find(const std::string& key)
+	const Datum* Action::FindArgument(const Symbol& key) const
 	{
 		WorldState* worldState = GetWorldState();
 		if (worldState != nullptr && !(worldState->GetCallStack().IsEmpty()))
 		{
-			Scope& scopeStackFrame = worldState->GetCallStack().Top();
+			const Datum* found = worldState->GetCallStack().Top().Find(key);
+			if (found != nullptr)
+			{
+				return found;
+			}
+		}
+
+		return Scope::Find(key);
+	}
 
-			auto found = scopeStackFrame.Find(key);
+	Datum* Action::FindArgumentForWrite(const Symbol& key)
+	{
+		WorldState* worldState = GetWorldState();
+		if (worldState != nullptr && !(worldState->GetCallStack().IsEmpty()))
+		{
+			// arguments are shared with every reaction of the event, the frame hands out its own copy to write to
+			Datum* found = worldState->GetCallStack().Top().FindWritable(key);
 			if (found != nullptr)
 			{
 				return found;
@@ -67,9 +81,15 @@ namespace Library
 	{
 	}
 
-	WorldState* Action::GetWorldState()
+	WorldState* Action::GetWorldState() const
 	{
-		Scope* scope = this;
+		// an action is never a world, the world state is found from its parent up
+		Scope* scope = GetParent();
+		if (scope == nullptr)
+		{
+			return nullptr;
+		}
+
 		while (scope->GetParent() != nullptr)
 		{
 			scope = scope->GetParent();
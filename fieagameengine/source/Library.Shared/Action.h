@@ -84,7 +84,21 @@ namespace Library
 		/// <returns>Signatures</returns>
 		static Vector<Signature> Signatures();
 		
-		virtual Datum* Find(const std::string& key) override;
+		/// <summary>
+		/// Finds an attribute, checking the top of the world's call stack (the current reaction's arguments) before this Action's own attributes.
+		/// An argument found there is the one every reaction of the event shares, read in place (CallFrame::Find).
+		/// Find and Search only look at the attributes, not the arguments
+		/// </summary>
+		/// <param name="key">interned key</param>
+		/// <returns>address of the Datum if found, otherwise nullptr</returns>
+		const Datum* FindArgument(const Symbol& key) const;
+		/// <summary>
+		/// Finds an attribute to write to, like FindArgument. An argument found is the frame's copy (CallFrame::FindWritable),
+		/// writing to it leaves the event's message as it was
+		/// </summary>
+		/// <param name="key">interned key</param>
+		/// <returns>address of the Datum if found, otherwise nullptr</returns>
+		Datum* FindArgumentForWrite(const Symbol& key);
 
 	protected:
 		/// <summary>
@@ -94,7 +108,7 @@ namespace Library
 		/// <param name="name">instance name</param>
 		Action(RTTI::IdType typeId, const std::string& name);
 
-		WorldState* GetWorldState();
+		WorldState* GetWorldState() const;
 
 		std::string mActionName;
 	};
@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "ActionBatcher.h"
+#include "Entity.h"
+#include "Sector.h"
+
+namespace Library
+{
+	Hashmap<RTTI::IdType, ActionBatcher::BatchFunction> ActionBatcher::sBatchFunctions;
+	Hashmap<RTTI::IdType, Vector<RTTI::IdType>> ActionBatcher::sSuccessors;
+
+	void ActionBatcher::UnregisterBatch(RTTI::IdType typeId)
+	{
+		sBatchFunctions.Remove(typeId);
+	}
+
+	void ActionBatcher::DeclareOrder(RTTI::IdType before, RTTI::IdType after)
+	{
+		auto [it, isNew] = sSuccessors.Insert(std::make_pair(before, Vector<RTTI::IdType>()));
+		Vector<RTTI::IdType>& successors = (*it).second;
+		if (successors.Find(after) == successors.end())
+		{
+			successors.PushBack(after);
+		}
+	}
+
+	void ActionBatcher::Clear()
+	{
+		sBatchFunctions.Clear();
+		sSuccessors.Clear();
+	}
+
+	void ActionBatcher::Update(Sector& sector, WorldState& worldState)
+	{
+		Gather(sector);
+		SortGroups();
+
+		for (std::size_t index : mOrder)
+		{
+			Group& group = mGroups[index];
+			auto it = sBatchFunctions.Find(group.Type);
+			BatchFunction batch = (it != sBatchFunctions.end() ? (*it).second : &UpdateVirtual);
+
+			batch(&group.Entries[0], group.Entries.Size(), worldState);
+			group.Entries.Clear();
+		}
+		mOrder.Clear();
+
+		worldState.entity = nullptr;
+		worldState.action = nullptr;
+	}
+
+	void ActionBatcher::Gather(Sector& sector)
+	{
+		// anything left over from an update that threw
+		for (std::size_t index : mOrder)
+		{
+			mGroups[index].Entries.Clear();
+		}
+		mOrder.Clear();
+
+		Datum& entities = sector.Entities();
+		for (std::size_t i = 0; i < entities.Size(); ++i)
+		{
+			Scope& entityScope = entities[i];
+			assert(entityScope.Is<Entity>());
+			Entity& entity = static_cast<Entity&>(entityScope);
+
+			Datum& actions = entity.Actions();
+			for (std::size_t j = 0; j < actions.Size(); ++j)
+			{
+				Scope& actionScope = actions[j];
+				assert(actionScope.Is<Action>());
+				Action& action = static_cast<Action&>(actionScope);
+
+				const RTTI::IdType type = action.TypeIdInstance();
+				auto [it, isNew] = mGroupIndices.Insert(std::make_pair(type, mGroups.Size()));
+				if (isNew)
+				{
+					mGroups.PushBack(Group{ type, Vector<Entry>() });
+				}
+
+				Group& group = mGroups[(*it).second];
+				if (group.Entries.IsEmpty())
+				{
+					mOrder.PushBack((*it).second);
+				}
+				group.Entries.PushBack(Entry{ &entity, &action });
+			}
+		}
+	}
+
+	void ActionBatcher::SortGroups()
+	{
+		if (sSuccessors.Size() == 0 || mOrder.Size() < 2)
+		{
+			return;
+		}
+
+		// Kahn's algorithm over the groups present, the ready group seen first goes next
+		Vector<std::size_t> predecessorCounts(mOrder.Size());
+		predecessorCounts.Resize(mOrder.Size());
+		auto successorsOf = [this](std::size_t position) -> const Vector<RTTI::IdType>*
+		{
+			auto it = sSuccessors.Find(mGroups[mOrder[position]].Type);
+			return (it != sSuccessors.end() ? &(*it).second : nullptr);
+		};
+		auto positionOf = [this](RTTI::IdType type)
+		{
+			std::size_t position = 0;
+			for (; position < mOrder.Size(); ++position)
+			{
+				if (mGroups[mOrder[position]].Type == type)
+				{
+					break;
+				}
+			}
+			return position;
+		};
+
+		for (std::size_t i = 0; i < mOrder.Size(); ++i)
+		{
+			if (const Vector<RTTI::IdType>* successors = successorsOf(i))
+			{
+				for (RTTI::IdType successor : *successors)
+				{
+					const std::size_t position = positionOf(successor);
+					if (position < mOrder.Size())
+					{
+						++predecessorCounts[position];
+					}
+				}
+			}
+		}
+
+		Vector<std::size_t> sorted(mOrder.Size());
+		Vector<bool> isPlaced(mOrder.Size());
+		isPlaced.Resize(mOrder.Size());
+		while (sorted.Size() < mOrder.Size())
+		{
+			std::size_t next = 0;
+			for (; next < mOrder.Size(); ++next)
+			{
+				if (!isPlaced[next] && predecessorCounts[next] == 0)
+				{
+					break;
+				}
+			}
+			if (next == mOrder.Size())
+			{
+				throw std::runtime_error("The declared action orders form a cycle.");
+			}
+
+			isPlaced[next] = true;
+			sorted.PushBack(mOrder[next]);
+			if (const Vector<RTTI::IdType>* successors = successorsOf(next))
+			{
+				for (RTTI::IdType successor : *successors)
+				{
+					const std::size_t position = positionOf(successor);
+					if (position < mOrder.Size())
+					{
+						--predecessorCounts[position];
+					}
+				}
+			}
+		}
+
+		mOrder = std::move(sorted);
+	}
+
+	void ActionBatcher::UpdateVirtual(const Entry* entries, std::size_t count, WorldState& worldState)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			worldState.entity = entries[i].Owner;
+			worldState.action = entries[i].Target;
+
+			entries[i].Target->Update(worldState);
+		}
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "Action.h"
+#include "hashmap.h"
+#include "vector.h"
+
+namespace Library
+{
+	class Entity;
+	class Sector;
+
+	/// <summary>
+	/// Runs the actions of a sector grouped by concrete type instead of entity by entity.
+	/// Every entity's actions are gathered into one group per type, and each group runs as a single batch.
+	/// Types registered with RegisterBatch run through a loop that calls their Update non-virtually, the others through a virtual call per action.
+	/// Groups run in the order their types first appear in the sector, unless DeclareOrder says otherwise.
+	/// Within a group, actions keep the entity and declaration order.
+	/// Only the actions directly under an entity are gathered (an ActionList runs its children itself).
+	/// An action created during the batched update first runs on the next update.
+	/// </summary>
+	class ActionBatcher final
+	{
+	public:
+		/// <summary>
+		/// An action to run and the entity it belongs to
+		/// </summary>
+		struct Entry final
+		{
+			Entity* Owner;
+			Action* Target;
+		};
+
+		/// <summary>
+		/// Updates count actions of one concrete type
+		/// </summary>
+		using BatchFunction = void(*)(const Entry* entries, std::size_t count, WorldState& worldState);
+
+		/// <summary>
+		/// Default Constructor
+		/// </summary>
+		ActionBatcher() = default;
+		/// <summary>
+		/// Copy Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a const ActionBatcher reference</param>
+		ActionBatcher(const ActionBatcher& rhs) = default;
+		/// <summary>
+		/// Move Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a ActionBatcher&&</param>
+		ActionBatcher(ActionBatcher&& rhs) noexcept = default;
+		/// <summary>
+		/// Copy Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a const ActionBatcher reference</param>
+		/// <returns>Copied ActionBatcher</returns>
+		ActionBatcher& operator=(const ActionBatcher& rhs) = default;
+		/// <summary>
+		/// Move Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a ActionBatcher&&</param>
+		/// <returns>Moved ActionBatcher</returns>
+		ActionBatcher& operator=(ActionBatcher&& rhs) noexcept = default;
+		/// <summary>
+		/// Destructor
+		/// </summary>
+		~ActionBatcher() = default;
+
+		/// <summary>
+		/// (static) Lets the actions of a concrete type run through a loop that calls ActionT::Update non-virtually
+		/// </summary>
+		/// <typeparam name="ActionT">concrete action type, with its own RTTI</typeparam>
+		template <typename ActionT>
+		static void RegisterBatch();
+		/// <summary>
+		/// (static) Goes back to virtual calls for a type
+		/// </summary>
+		/// <param name="typeId">type id of the action</param>
+		static void UnregisterBatch(RTTI::IdType typeId);
+		/// <summary>
+		/// (static) Declares that every action of one type runs before any action of another in the same sector
+		/// </summary>
+		/// <param name="before">type id that runs first</param>
+		/// <param name="after">type id that runs after it</param>
+		static void DeclareOrder(RTTI::IdType before, RTTI::IdType after);
+		/// <summary>
+		/// (static) Forgets the registered batches and declared orders
+		/// </summary>
+		static void Clear();
+
+		/// <summary>
+		/// Gathers the actions of every entity in the sector and runs them, one group per concrete type.
+		/// Throws if the declared orders of the types present form a cycle
+		/// </summary>
+		/// <param name="sector">sector to update</param>
+		/// <param name="worldState">world state, its entity and action are set before each action runs</param>
+		void Update(Sector& sector, WorldState& worldState);
+
+	private:
+		struct Group final
+		{
+			RTTI::IdType Type;
+			Vector<Entry> Entries;
+		};
+
+		void Gather(Sector& sector);
+		void SortGroups();
+
+		template <typename ActionT>
+		static void UpdateBatch(const Entry* entries, std::size_t count, WorldState& worldState);
+		static void UpdateVirtual(const Entry* entries, std::size_t count, WorldState& worldState);
+
+		// groups are kept from one update to the next, so their entries are reused rather than reallocated
+		Vector<Group> mGroups;
+		Hashmap<RTTI::IdType, std::size_t> mGroupIndices;
+		// groups gathered this update, in the order they run
+		Vector<std::size_t> mOrder;
+
+		static Hashmap<RTTI::IdType, BatchFunction> sBatchFunctions;
+		static Hashmap<RTTI::IdType, Vector<RTTI::IdType>> sSuccessors;
+	};
+}
+
+#include "ActionBatcher.inl"
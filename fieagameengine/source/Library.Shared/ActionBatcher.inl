@@ -0,0 +1,25 @@
+#include "ActionBatcher.h"
+
+namespace Library
+{
+	template <typename ActionT>
+	inline void ActionBatcher::RegisterBatch()
+	{
+		UnregisterBatch(ActionT::TypeIdClass());
+		sBatchFunctions.Insert(std::make_pair(ActionT::TypeIdClass(), &UpdateBatch<ActionT>));
+	}
+
+	template <typename ActionT>
+	inline void ActionBatcher::UpdateBatch(const Entry* entries, std::size_t count, WorldState& worldState)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			// every entry of the group is an ActionT, the qualified call needs no virtual dispatch
+			ActionT& action = static_cast<ActionT&>(*entries[i].Target);
+			worldState.entity = entries[i].Owner;
+			worldState.action = &action;
+
+			action.ActionT::Update(worldState);
+		}
+	}
+}
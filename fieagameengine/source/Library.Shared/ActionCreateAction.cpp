@@ -2,6 +2,7 @@
 #include "ActionCreateAction.h"
 #include "ActionList.h"
 #include "Entity.h"
+#include "World.h"
 
 namespace Library
 {
@@ -33,16 +34,24 @@ namespace Library
 
 		if (mClassName.empty() && mInstanceName.empty())
 		{
-			mClassName = (*this).Find("PrototypeName")->Get<std::string>();
-			mInstanceName = (*this).Find("InstanceName")->Get<std::string>();
+			static const Symbol prototypeNameKey("PrototypeName");
+			static const Symbol instanceNameKey("InstanceName");
+
+			mClassName = FindArgument(prototypeNameKey)->Get<std::string>();
+			mInstanceName = FindArgument(instanceNameKey)->Get<std::string>();
 		}
 
+		// the world defers it while its jobs run, they share the attribute pools the created type may have
 		auto parent = GetParent();
-		if (parent->Is(Entity::TypeIdClass()))
+		if (worldState.world != nullptr)
+		{
+			worldState.world->Spawn(*parent, mClassName, mInstanceName);
+		}
+		else if (parent->Is<Entity>())
 		{
 			parent->As<Entity>()->CreateAction(mClassName, mInstanceName);
 		}
-		else if (parent->Is(ActionList::TypeIdClass()))
+		else if (parent->Is<ActionList>())
 		{
 			parent->As<ActionList>()->CreateAction(mClassName, mInstanceName);
 		}
@@ -21,7 +21,8 @@ namespace Library
 		world_state.action = this;
 
 		SetWorld();
-		mActionInstanceName = (*this).Find("ActionInstanceName")->Get<std::string>();
+		static const Symbol actionInstanceNameKey("ActionInstanceName");
+		mActionInstanceName = FindArgument(actionInstanceNameKey)->Get<std::string>();
 
 		if (!mActionInstanceName.empty() && mWorld != nullptr)
 		{
@@ -69,7 +70,7 @@ namespace Library
 			worldCheckScope = worldCheckScope->GetParent();
 		}
 
-		if (worldCheckScope->Is(World::TypeIdClass()))
+		if (worldCheckScope->Is<World>())
 		{
 			mWorld = worldCheckScope->As<World>();
 		}
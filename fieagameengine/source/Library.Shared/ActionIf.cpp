@@ -20,15 +20,19 @@ namespace Library
 	{
 		worldState.action = this;
 
-		mConditionValue = (*this).Find("Condition")->Get<int32_t>();
-		Datum& actionIf = *((*this).Find("ThenAction"));
-		Datum& actionElse = *((*this).Find("ElseAction"));
+		static const Symbol conditionKey("Condition");
+		static const Symbol thenActionKey("ThenAction");
+		static const Symbol elseActionKey("ElseAction");
+
+		mConditionValue = FindArgument(conditionKey)->Get<int32_t>();
+		const Datum& actionIf = *FindArgument(thenActionKey);
+		const Datum& actionElse = *FindArgument(elseActionKey);
 				
 		if (mConditionValue)
 		{
 			for (size_t i = 0; i < actionIf.Size(); ++i)
 			{
-				assert(actionIf.Get<Scope*>()->Is(Action::TypeIdClass()));
+				assert(actionIf.Get<Scope*>()->Is<Action>());
 				static_cast<Action*>(actionIf.Get<Scope*>(i))->Update(worldState);
 			}
 		}
@@ -36,7 +40,7 @@ namespace Library
 		{
 			for (size_t i = 0; i < actionElse.Size(); ++i)
 			{
-				assert(actionElse.Get<Scope*>()->Is(Action::TypeIdClass()));
+				assert(actionElse.Get<Scope*>()->Is<Action>());
 				static_cast<Action*>(actionElse.Get<Scope*>(i))->Update(worldState);
 			}
 		}
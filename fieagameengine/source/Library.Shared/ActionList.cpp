@@ -23,7 +23,7 @@ namespace Library
 		for (uint32_t i = 0; i < actions.Size(); ++i)
 		{
 			Scope& actionScope = actions[i];
-			assert(actionScope.Is(Action::TypeIdClass()));
+			assert(actionScope.Is<Action>());
 
 			Action& tempAction = static_cast<Action&>(actionScope);
 			tempAction.Update(worldState);
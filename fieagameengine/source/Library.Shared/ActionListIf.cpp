@@ -26,12 +26,12 @@ namespace Library
 
 		if (condition)
 		{
-			assert(actionIf.Get<Scope*>()->Is(Action::TypeIdClass()));
+			assert(actionIf.Get<Scope*>()->Is<Action>());
 			static_cast<Action*>(actionIf.Get<Scope*>())->Update(worldState);
 		}
 		else
 		{
-			assert(actionElse.Get<Scope*>()->Is(Action::TypeIdClass()));
+			assert(actionElse.Get<Scope*>()->Is<Action>());
 			static_cast<Action*>(actionElse.Get<Scope*>())->Update(worldState);
 		}
 	}
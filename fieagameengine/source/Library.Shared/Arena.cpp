@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "Arena.h"
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <new>
+
+namespace Library
+{
+	namespace
+	{
+		std::byte* AlignUp(std::byte* data, std::size_t alignment)
+		{
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(data);
+			return reinterpret_cast<std::byte*>((address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+		}
+	}
+
+	thread_local Arena* Arena::sCurrent{ nullptr };
+
+#pragma region Guard
+
+	Arena::Guard::Guard(Arena* arena) :
+		mPrevious(sCurrent)
+	{
+		sCurrent = arena;
+	}
+
+	Arena::Guard::~Guard()
+	{
+		sCurrent = mPrevious;
+	}
+
+#pragma endregion Guard
+
+#pragma region Arena
+
+	Arena::Arena(std::size_t blockSize) :
+		mBlockSize(std::max(blockSize, MaxAlignment))
+	{
+	}
+
+	Arena::~Arena()
+	{
+		assert(sCurrent != this);
+
+		while (mBlocks != nullptr)
+		{
+			Block* next = mBlocks->Next;
+			free(mBlocks);
+			mBlocks = next;
+		}
+	}
+
+	void* Arena::Allocate(std::size_t size, std::size_t alignment)
+	{
+		assert(alignment > 0 && alignment <= MaxAlignment && (alignment & (alignment - 1)) == 0);
+
+		std::byte* start = AlignUp(mCursor, alignment);
+		if (mBlocks == nullptr || start > mEnd || size > static_cast<std::size_t>(mEnd - start))
+		{
+			AddBlock(size, alignment);
+			start = AlignUp(mCursor, alignment);
+		}
+
+		mCursor = start + size;
+		mLastAllocation = start;
+		mBytesUsed += size;
+		return start;
+	}
+
+	void* Arena::Reallocate(void* data, std::size_t oldSize, std::size_t newSize)
+	{
+		if (data == nullptr)
+		{
+			return Allocate(newSize);
+		}
+
+		std::byte* bytes = static_cast<std::byte*>(data);
+
+		// a Vector growing while it is being filled is usually the newest allocation, so it can simply extend
+		if (bytes == mLastAllocation && (newSize <= oldSize || newSize - oldSize <= static_cast<std::size_t>(mEnd - mCursor)))
+		{
+			mCursor = bytes + newSize;
+			mBytesUsed = mBytesUsed - oldSize + newSize;
+			return data;
+		}
+
+		void* moved = Allocate(newSize);
+		std::memcpy(moved, data, std::min(oldSize, newSize));
+		return moved;
+	}
+
+	void Arena::Reset()
+	{
+		if (mBlocks != nullptr)
+		{
+			Block* next = mBlocks->Next;
+			while (next != nullptr)
+			{
+				Block* following = next->Next;
+				free(next);
+				next = following;
+			}
+
+			mBlocks->Next = nullptr;
+			mCursor = reinterpret_cast<std::byte*>(mBlocks + 1);
+			mEnd = mCursor + mBlocks->Size;
+			mBlockCount = 1;
+		}
+
+		mLastAllocation = nullptr;
+		mBytesUsed = 0;
+	}
+
+	std::size_t Arena::BytesUsed() const
+	{
+		return mBytesUsed;
+	}
+
+	std::size_t Arena::BlockCount() const
+	{
+		return mBlockCount;
+	}
+
+	bool Arena::Owns(const void* data) const
+	{
+		const std::byte* bytes = static_cast<const std::byte*>(data);
+		for (const Block* block = mBlocks; block != nullptr; block = block->Next)
+		{
+			const std::byte* begin = reinterpret_cast<const std::byte*>(block + 1);
+			if (bytes >= begin && bytes < begin + block->Size)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	Arena* Arena::Current()
+	{
+		return sCurrent;
+	}
+
+	void Arena::AddBlock(std::size_t size, std::size_t alignment)
+	{
+		const std::size_t capacity = std::max(mBlockSize, size + alignment);
+
+		void* memory = malloc(sizeof(Block) + capacity);
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		Block* block = new (memory) Block{ mBlocks, capacity };
+		mBlocks = block;
+		mCursor = reinterpret_cast<std::byte*>(block + 1);
+		mEnd = mCursor + capacity;
+		++mBlockCount;
+	}
+
+#pragma endregion Arena
+}
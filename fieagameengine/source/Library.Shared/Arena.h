@@ -0,0 +1,125 @@
+#pragma once
+#include <cstddef>
+
+namespace Library
+{
+	/// <summary>
+	/// Monotonic allocator: hands out memory by bumping a cursor through large blocks and never frees individual allocations.
+	/// All blocks are released at once by Reset or the destructor, so a whole tree of objects can be dropped without a free per node.
+	/// Containers reach an arena through Memory while a Guard has made it current on the calling thread. A Guard only covers work on the tree
+	/// being built (appending, adopting, setting values): factories, subscriptions and anything else with state of its own run outside it.
+	/// An arena grows only on the thread it is current on, and has to outlive everything allocated from it.
+	/// </summary>
+	class Arena final
+	{
+	public:
+		/// <summary>
+		/// Makes an arena the current one on this thread for its lifetime, restoring the previous one afterwards.
+		/// A Guard for nullptr routes allocations back to the heap.
+		/// </summary>
+		class Guard final
+		{
+		public:
+			/// <summary>
+			/// Constructor
+			/// </summary>
+			/// <param name="arena">arena to allocate from, nullptr for the heap</param>
+			explicit Guard(Arena* arena);
+			Guard(const Guard&) = delete;
+			Guard(Guard&&) = delete;
+			Guard& operator=(const Guard&) = delete;
+			Guard& operator=(Guard&&) = delete;
+			/// <summary>
+			/// Destructor, restores the previously current arena
+			/// </summary>
+			~Guard();
+
+		private:
+			Arena* mPrevious{ nullptr };
+		};
+
+		inline static const std::size_t DefaultBlockSize = 64 * 1024;
+		inline static const std::size_t MaxAlignment = 16;
+
+		/// <summary>
+		/// Constructor, no memory is reserved until the first allocation
+		/// </summary>
+		/// <param name="blockSize">size of each block, allocations larger than this get a block of their own</param>
+		explicit Arena(std::size_t blockSize = DefaultBlockSize);
+		Arena(const Arena&) = delete;
+		Arena(Arena&&) = delete;
+		Arena& operator=(const Arena&) = delete;
+		Arena& operator=(Arena&&) = delete;
+		/// <summary>
+		/// Destructor, releases every block
+		/// </summary>
+		~Arena();
+
+		/// <summary>
+		/// Allocates size bytes from the current block, starting a new block when it does not fit
+		/// </summary>
+		/// <param name="size">number of bytes</param>
+		/// <param name="alignment">power of two, up to MaxAlignment</param>
+		/// <returns>pointer to the memory</returns>
+		void* Allocate(std::size_t size, std::size_t alignment = MaxAlignment);
+		/// <summary>
+		/// Resizes an allocation made by this arena. The newest allocation grows in place while the block has room,
+		/// anything else is copied into a new allocation (the old bytes are not reused)
+		/// </summary>
+		/// <param name="data">allocation from this arena</param>
+		/// <param name="oldSize">current size of the allocation</param>
+		/// <param name="newSize">requested size</param>
+		/// <returns>pointer to the resized memory</returns>
+		void* Reallocate(void* data, std::size_t oldSize, std::size_t newSize);
+		/// <summary>
+		/// Drops every allocation at once, keeping the newest block for reuse.
+		/// Everything allocated from the arena has to be dead (or never touched again) by then.
+		/// </summary>
+		void Reset();
+
+		/// <summary>
+		/// Gets the number of bytes handed out since construction or the last Reset
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t BytesUsed() const;
+		/// <summary>
+		/// Gets the number of blocks currently held
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t BlockCount() const;
+		/// <summary>
+		/// Returns true if the pointer lies inside one of this arena's blocks
+		/// </summary>
+		/// <param name="data">pointer to check</param>
+		/// <returns>bool</returns>
+		bool Owns(const void* data) const;
+
+		/// <summary>
+		/// Gets the arena Memory allocates from on this thread
+		/// </summary>
+		/// <returns>current arena, nullptr when allocating from the heap</returns>
+		static Arena* Current();
+
+	private:
+		struct alignas(MaxAlignment) Block final
+		{
+			Block* Next{ nullptr };
+			std::size_t Size{ 0 };
+		};
+
+		/// <summary>
+		/// Starts a new block able to hold at least size bytes at the given alignment
+		/// </summary>
+		void AddBlock(std::size_t size, std::size_t alignment);
+
+		Block* mBlocks{ nullptr };
+		std::byte* mCursor{ nullptr };
+		std::byte* mEnd{ nullptr };
+		std::byte* mLastAllocation{ nullptr };
+		std::size_t mBlockSize{ DefaultBlockSize };
+		std::size_t mBytesUsed{ 0 };
+		std::size_t mBlockCount{ 0 };
+
+		static thread_local Arena* sCurrent;
+	};
+}
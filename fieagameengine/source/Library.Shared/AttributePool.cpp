@@ -0,0 +1,292 @@
+#include "pch.h"
+#include "AttributePool.h"
+#include "Attributed.h"
+#include "Memory.h"
+#include <memory>
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// Calls function with a null pointer of the C++ type that stores values of a pooled DatumTypes
+		/// </summary>
+		template <typename Function>
+		void VisitType(Datum::DatumTypes type, Function&& function)
+		{
+			switch (type)
+			{
+			case Datum::DatumTypes::Integer:
+				function(static_cast<std::int32_t*>(nullptr));
+				break;
+			case Datum::DatumTypes::Float:
+				function(static_cast<std::float_t*>(nullptr));
+				break;
+			case Datum::DatumTypes::Vector:
+				function(static_cast<glm::vec4*>(nullptr));
+				break;
+			case Datum::DatumTypes::Matrix:
+				function(static_cast<glm::mat4*>(nullptr));
+				break;
+			case Datum::DatumTypes::String:
+				function(static_cast<std::string*>(nullptr));
+				break;
+			case Datum::DatumTypes::Pointer:
+				function(static_cast<RTTI**>(nullptr));
+				break;
+			default:
+				throw std::runtime_error("Only Integer, Float, Vector, Matrix, String and Pointer attributes can be pooled.");
+			}
+		}
+	}
+
+	AttributePool::AttributePool(const Vector<Signature>& signatures)
+	{
+		for (std::size_t i = 0; i < signatures.Size(); ++i)
+		{
+			const Signature& sig = signatures[i];
+			if (sig.mOffset == Signature::Pooled)
+			{
+				std::size_t elementSize = 0;
+				VisitType(sig.mType, [&elementSize](auto tag) { elementSize = sizeof(*tag); });
+
+				// "this" comes first in an instance's attributes, signature i is at i + 1
+				mColumns.PushBack({ Symbol::Intern(sig.mName), i + 1, sig.mType, sig.mSize, elementSize, nullptr });
+			}
+		}
+	}
+
+	AttributePool::AttributePool(AttributePool&& rhs) noexcept :
+		mColumns(std::move(rhs.mColumns)), mOwners(std::move(rhs.mOwners)), mCapacity(rhs.mCapacity)
+	{
+		assert(mOwners.IsEmpty());
+		rhs.mCapacity = 0;
+	}
+
+	AttributePool& AttributePool::operator=(AttributePool&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			assert(mOwners.IsEmpty() && rhs.mOwners.IsEmpty());
+			Free();
+			mColumns = std::move(rhs.mColumns);
+			mOwners = std::move(rhs.mOwners);
+			mCapacity = rhs.mCapacity;
+
+			rhs.mCapacity = 0;
+		}
+
+		return *this;
+	}
+
+	AttributePool::~AttributePool()
+	{
+		Free();
+	}
+
+	std::size_t AttributePool::ColumnCount() const
+	{
+		return mColumns.Size();
+	}
+
+	std::size_t AttributePool::ColumnIndex(const Symbol& name) const
+	{
+		std::size_t column = 0;
+		for (; column < mColumns.Size(); ++column)
+		{
+			if (mColumns[column].Name == name)
+			{
+				break;
+			}
+		}
+
+		return column;
+	}
+
+	Datum::DatumTypes AttributePool::ColumnType(std::size_t column) const
+	{
+		return mColumns[column].Type;
+	}
+
+	std::size_t AttributePool::ColumnWidth(std::size_t column) const
+	{
+		return mColumns[column].Width;
+	}
+
+	std::size_t AttributePool::Size() const
+	{
+		return mOwners.Size();
+	}
+
+	bool AttributePool::IsEmpty() const
+	{
+		return mOwners.IsEmpty();
+	}
+
+	Attributed& AttributePool::Owner(std::size_t row) const
+	{
+		return *mOwners[row];
+	}
+
+	void AttributePool::Acquire(Attributed& owner, const Attributed* source)
+	{
+		assert(owner.mPool == nullptr);
+
+		std::scoped_lock<std::mutex> lock(mMutex);
+
+		const std::size_t row = mOwners.Size();
+		if (row == mCapacity)
+		{
+			Reserve(mCapacity > 0 ? mCapacity * 2 : 16);
+		}
+
+		for (std::size_t column = 0; column < mColumns.Size(); ++column)
+		{
+			const ColumnData& data = mColumns[column];
+			void* slot = Slot(row, column);
+			VisitType(data.Type, [slot, &data](auto tag)
+			{
+				using T = std::remove_pointer_t<decltype(tag)>;
+				std::uninitialized_value_construct_n(static_cast<T*>(slot), data.Width);
+			});
+		}
+
+		mOwners.PushBack(&owner);
+		owner.mPool = this;
+		owner.mPoolRow = row;
+		Bind(row);
+
+		// the source's row is read under the lock, a release on another thread may be moving it
+		if (source != nullptr && source->mPool == this)
+		{
+			CopyRow(source->mPoolRow, row);
+		}
+	}
+
+	void AttributePool::Transfer(Attributed& from, Attributed& to)
+	{
+		assert(from.mPool == this && to.mPool == nullptr);
+
+		std::scoped_lock<std::mutex> lock(mMutex);
+		to.mPool = this;
+		to.mPoolRow = from.mPoolRow;
+		from.mPool = nullptr;
+		mOwners[to.mPoolRow] = &to;
+	}
+
+	void AttributePool::Release(Attributed& owner)
+	{
+		assert(owner.mPool == this);
+
+		std::scoped_lock<std::mutex> lock(mMutex);
+		const std::size_t row = owner.mPoolRow;
+		const std::size_t last = mOwners.Size() - 1;
+		for (std::size_t column = 0; column < mColumns.Size(); ++column)
+		{
+			const ColumnData& data = mColumns[column];
+			void* released = Slot(row, column);
+			void* moved = Slot(last, column);
+			VisitType(data.Type, [released, moved, row, last, &data](auto tag)
+			{
+				using T = std::remove_pointer_t<decltype(tag)>;
+				if (row != last)
+				{
+					std::move(static_cast<T*>(moved), static_cast<T*>(moved) + data.Width, static_cast<T*>(released));
+				}
+				std::destroy_n(static_cast<T*>(moved), data.Width);
+			});
+		}
+
+		if (row != last)
+		{
+			Attributed* movedOwner = mOwners[last];
+			mOwners[row] = movedOwner;
+			movedOwner->mPoolRow = row;
+			Bind(row);
+		}
+		mOwners.PopBack();
+		owner.mPool = nullptr;
+	}
+
+	void AttributePool::CopyRow(std::size_t source, std::size_t target)
+	{
+		for (std::size_t column = 0; column < mColumns.Size(); ++column)
+		{
+			const ColumnData& data = mColumns[column];
+			void* from = Slot(source, column);
+			void* to = Slot(target, column);
+			VisitType(data.Type, [from, to, &data](auto tag)
+			{
+				using T = std::remove_pointer_t<decltype(tag)>;
+				std::copy_n(static_cast<T*>(from), data.Width, static_cast<T*>(to));
+			});
+		}
+	}
+
+	void* AttributePool::Slot(std::size_t row, std::size_t column) const
+	{
+		const ColumnData& data = mColumns[column];
+		return data.Data + row * data.Width * data.ElementSize;
+	}
+
+	void AttributePool::Reserve(std::size_t capacity)
+	{
+		const std::size_t size = mOwners.Size();
+		for (ColumnData& data : mColumns)
+		{
+			std::uint8_t* moved = static_cast<std::uint8_t*>(Memory::Allocate(capacity * data.Width * data.ElementSize));
+			std::uint8_t* old = data.Data;
+			VisitType(data.Type, [moved, old, size, &data](auto tag)
+			{
+				using T = std::remove_pointer_t<decltype(tag)>;
+				if (old != nullptr)
+				{
+					std::uninitialized_move_n(reinterpret_cast<T*>(old), size * data.Width, reinterpret_cast<T*>(moved));
+					std::destroy_n(reinterpret_cast<T*>(old), size * data.Width);
+				}
+			});
+
+			Memory::Free(old);
+			data.Data = moved;
+		}
+		mCapacity = capacity;
+
+		// every row moved, the owners' datums follow
+		for (std::size_t row = 0; row < size; ++row)
+		{
+			Bind(row);
+		}
+	}
+
+	void AttributePool::Bind(std::size_t row)
+	{
+		const Scope::OrderedVector& attributes = mOwners[row]->GetAttributes();
+		for (std::size_t column = 0; column < mColumns.Size(); ++column)
+		{
+			const ColumnData& data = mColumns[column];
+			attributes[data.Index]->second.SetStorage(Slot(row, column), data.Width);
+		}
+	}
+
+	void AttributePool::Free()
+	{
+		for (ColumnData& data : mColumns)
+		{
+			if (data.Data != nullptr)
+			{
+				std::uint8_t* values = data.Data;
+				const std::size_t count = mOwners.Size() * data.Width;
+				VisitType(data.Type, [values, count](auto tag)
+				{
+					using T = std::remove_pointer_t<decltype(tag)>;
+					std::destroy_n(reinterpret_cast<T*>(values), count);
+				});
+
+				Memory::Free(data.Data);
+				data.Data = nullptr;
+			}
+		}
+		mOwners.Clear();
+		mCapacity = 0;
+	}
+}
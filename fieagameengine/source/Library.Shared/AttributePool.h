@@ -0,0 +1,147 @@
+#pragma once
+#include <mutex>
+#include "Signature.h"
+#include "Symbol.h"
+#include "vector.h"
+
+namespace Library
+{
+	class Attributed;
+
+	/// <summary>
+	/// Structure-of-arrays storage for the pooled prescribed attributes of one Attributed type,
+	/// the signatures declared with Signature::Pooled instead of a member offset.
+	/// Every pooled signature is a column and every live instance a row. The instance's datums point into its row
+	/// as external storage, so Scope based access keeps working while a system walks a column linearly.
+	/// Rows stay dense: releasing one moves the last row into its place. Columns move when the pool grows,
+	/// so pointers into a column are only good until the next Acquire or Release.
+	/// Acquire, Transfer and Release are serialized by the pool's mutex, so instances of the type can be made and destroyed
+	/// on several threads. The values are not: while instances are made or destroyed rows move, and with them the storage
+	/// of every instance's pooled datums, so nothing may read or write those (or walk a column) on another thread meanwhile.
+	/// </summary>
+	class AttributePool final
+	{
+	public:
+		/// <summary>
+		/// Constructor, one column per pooled signature, no rows are reserved until the first Acquire
+		/// </summary>
+		/// <param name="signatures">prescribed attributes of the type</param>
+		explicit AttributePool(const Vector<Signature>& signatures);
+		/// <summary>
+		/// Copy Constructor (deleted)
+		/// </summary>
+		AttributePool(const AttributePool& rhs) = delete;
+		/// <summary>
+		/// Move Constructor, only for a pool with no rows (the owners point at the pool they were acquired from)
+		/// </summary>
+		/// <param name="rhs">Takes in a AttributePool&&</param>
+		AttributePool(AttributePool&& rhs) noexcept;
+		/// <summary>
+		/// Copy Assignment (deleted)
+		/// </summary>
+		AttributePool& operator=(const AttributePool& rhs) = delete;
+		/// <summary>
+		/// Move Assignment, only for pools with no rows
+		/// </summary>
+		/// <param name="rhs">Takes in a AttributePool&&</param>
+		/// <returns>Moved AttributePool</returns>
+		AttributePool& operator=(AttributePool&& rhs) noexcept;
+		/// <summary>
+		/// Destructor
+		/// </summary>
+		~AttributePool();
+
+		/// <summary>
+		/// Gets the number of pooled signatures
+		/// </summary>
+		/// <returns>number of columns, 0 when the type pools nothing</returns>
+		std::size_t ColumnCount() const;
+		/// <summary>
+		/// Finds the column of a pooled signature
+		/// </summary>
+		/// <param name="name">signature name</param>
+		/// <returns>column index, ColumnCount() if the signature is not pooled</returns>
+		std::size_t ColumnIndex(const Symbol& name) const;
+		/// <summary>
+		/// Gets the type of the values in a column
+		/// </summary>
+		/// <param name="column">column index</param>
+		/// <returns>DatumTypes</returns>
+		Datum::DatumTypes ColumnType(std::size_t column) const;
+		/// <summary>
+		/// Gets the number of values each row holds in a column (the signature's size)
+		/// </summary>
+		/// <param name="column">column index</param>
+		/// <returns>values per row</returns>
+		std::size_t ColumnWidth(std::size_t column) const;
+		/// <summary>
+		/// Gets the values of a column, Size() * ColumnWidth(column) of them with row r starting at r * ColumnWidth(column)
+		/// </summary>
+		/// <typeparam name="T">C++ type of the column's DatumTypes</typeparam>
+		/// <param name="column">column index</param>
+		/// <returns>first value of the column</returns>
+		template <typename T>
+		T* Column(std::size_t column);
+		template <typename T>
+		const T* Column(std::size_t column) const;
+
+		/// <summary>
+		/// Gets the number of rows, one per live instance
+		/// </summary>
+		/// <returns>number of rows</returns>
+		std::size_t Size() const;
+		/// <summary>
+		/// Returns true if there are no rows
+		/// </summary>
+		/// <returns>bool</returns>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Gets the instance a row belongs to
+		/// </summary>
+		/// <param name="row">row index</param>
+		/// <returns>Attributed</returns>
+		Attributed& Owner(std::size_t row) const;
+
+		/// <summary>
+		/// Adds a row for an instance and points its pooled datums at it
+		/// </summary>
+		/// <param name="owner">instance the row belongs to, without a row yet</param>
+		/// <param name="source">instance whose values the row starts with if it has a row in this pool, nullptr for default values</param>
+		void Acquire(Attributed& owner, const Attributed* source = nullptr);
+		/// <summary>
+		/// Hands the row of a moved instance over to the instance it was moved into, whose pooled datums already point at it
+		/// </summary>
+		/// <param name="from">moved instance, left without a row</param>
+		/// <param name="to">instance taking the row</param>
+		void Transfer(Attributed& from, Attributed& to);
+		/// <summary>
+		/// Removes an instance's row, the last row takes its place and its owner's datums are pointed at it
+		/// </summary>
+		/// <param name="owner">instance giving its row back, left without a row</param>
+		void Release(Attributed& owner);
+
+	private:
+		struct ColumnData final
+		{
+			Symbol Name;
+			std::size_t Index; // position of the signature's datum in an instance's attributes
+			Datum::DatumTypes Type;
+			std::size_t Width;
+			std::size_t ElementSize;
+			std::uint8_t* Data;
+		};
+
+		void* Slot(std::size_t row, std::size_t column) const;
+		void CopyRow(std::size_t source, std::size_t target);
+		void Reserve(std::size_t capacity);
+		void Bind(std::size_t row);
+		void Free();
+
+		Vector<ColumnData> mColumns;
+		Vector<Attributed*> mOwners;
+		std::size_t mCapacity{ 0 };
+		std::mutex mMutex;
+	};
+}
+
+#include "AttributePool.inl"
@@ -0,0 +1,18 @@
+#include "AttributePool.h"
+
+namespace Library
+{
+	template <typename T>
+	inline T* AttributePool::Column(std::size_t column)
+	{
+		assert(sizeof(T) == mColumns[column].ElementSize);
+		return reinterpret_cast<T*>(mColumns[column].Data);
+	}
+
+	template <typename T>
+	inline const T* AttributePool::Column(std::size_t column) const
+	{
+		assert(sizeof(T) == mColumns[column].ElementSize);
+		return reinterpret_cast<const T*>(mColumns[column].Data);
+	}
+}
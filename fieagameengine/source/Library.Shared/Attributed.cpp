@@ -9,7 +9,6 @@ namespace Library
 	Attributed::Attributed(std::size_t typeId) :
 		Scope()
 	{
-		(*this)["this"] = this;
 		Populate(typeId);
 	}
 
@@ -18,6 +17,7 @@ namespace Library
 	{
 		(*this)["this"] = this;
 		UpdateExternalStorage(rhs.TypeIdInstance());
+		AcquirePooledStorage(rhs.TypeIdInstance(), &rhs);
 	}
 
 	Attributed::Attributed(Attributed&& rhs) noexcept:
@@ -25,16 +25,19 @@ namespace Library
 	{
 		(*this)["this"] = this;
 		UpdateExternalStorage(rhs.TypeIdInstance());
+		TakePooledStorage(rhs);
 	}
 
 	Attributed& Attributed::operator=(const Attributed& rhs)
 	{
 		if (this != &rhs)
 		{
+			ReleasePooledStorage();
 			Scope::operator=(rhs);
 
 			(*this)["this"] = this;
 			UpdateExternalStorage(rhs.TypeIdInstance());
+			AcquirePooledStorage(rhs.TypeIdInstance(), &rhs);
 		}
 		return *this;
 	}
@@ -43,14 +46,22 @@ namespace Library
 	{
 		if (this != &rhs)
 		{
+			// released first, the row moved into ours may be rhs's and its datums have to still be in rhs
+			ReleasePooledStorage();
 			Scope::operator=(std::move(rhs));
 
 			(*this)["this"] = this;
 			UpdateExternalStorage(rhs.TypeIdInstance());
+			TakePooledStorage(rhs);
 		}
 		return *this;
 	}
 
+	Attributed::~Attributed()
+	{
+		ReleasePooledStorage();
+	}
+
 	bool Attributed::operator==(const Attributed& rhs) const
 	{
 		bool isEqual = (GetParent() == rhs.GetParent() && GetOrderedVector().Size() == rhs.GetOrderedVector().Size());
@@ -93,23 +104,14 @@ namespace Library
 
 	bool Attributed::IsPrescribedAttribute(const std::string& name) const
 	{
-		bool found = false;
-		const OrderedVector attrPtr = Scope::GetOrderedVector();
-		if ("this" == name)
-		{
-			return true;
-		}
+		// prescribed names were interned when the type was registered
+		const Symbol key = Symbol::TryFind(name);
+		return key.IsValid() && IsPrescribedAttribute(key);
+	}
 
-		Vector<Signature> signatures = TypeManager::GetSignatures(TypeIdInstance());
-		for (auto& sig : signatures)
-		{
-			if (sig.mName == name)
-			{
-				found = true;
-				break;
-			}
-		}
-		return found;
+	bool Attributed::IsPrescribedAttribute(const Symbol& name) const
+	{
+		return TypeManager::GetDescriptor(TypeIdInstance()).IsPrescribed(name);
 	}
 
 	bool Attributed::IsAuxiliaryAttribute(const std::string& name) const
@@ -142,75 +144,92 @@ namespace Library
 
 	typename Scope::OrderedVector Attributed::GetPrescribedAttributes() const
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(TypeIdInstance());
-		OrderedVector pAttributes(Scope::GetOrderedVector());
-		pAttributes.Resize(signatures.Size());
+		const std::size_t prescribedCount = TypeManager::GetDescriptor(TypeIdInstance()).PrescribedCount();
+		const OrderedVector& attributes = Scope::GetOrderedVector();
+		OrderedVector pAttributes;
+
+		pAttributes.Reserve(prescribedCount);
+		for (std::size_t i = 0; i < prescribedCount && i < attributes.Size(); ++i)
+		{
+			pAttributes.PushBack(attributes[i]);
+		}
 
 		return pAttributes;
 	}
 
 	typename Scope::OrderedVector Attributed::GetAuxiliaryAttributes() const
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(TypeIdInstance());
-		OrderedVector copyAttributes(Scope::GetOrderedVector());
+		const OrderedVector& attributes = Scope::GetOrderedVector();
+		const std::size_t auxiliaryAttributeBeginIndex = TypeManager::GetDescriptor(TypeIdInstance()).PrescribedCount();
 		OrderedVector aAttributes;
 
-		for (std::size_t i = signatures.Size() + 1; i < copyAttributes.Size(); ++i)
+		if (attributes.Size() > auxiliaryAttributeBeginIndex)
 		{
-			aAttributes.PushBack(copyAttributes[i]);
+			aAttributes.Reserve(attributes.Size() - auxiliaryAttributeBeginIndex);
+			for (std::size_t i = auxiliaryAttributeBeginIndex; i < attributes.Size(); ++i)
+			{
+				aAttributes.PushBack(attributes[i]);
+			}
 		}
 
-		aAttributes.Resize(aAttributes.Size());
-
 		return aAttributes;
 	}
 
 	void Attributed::ForEachAuxiliaryAttribute(AuxiliaryAttributeFunction func) const
 	{
-		const auto signatures = TypeManager::GetSignatures(TypeIdInstance());
-		size_t auxiliaryAttributeBeginIndex = signatures.Size() + 1; // +1 for the "this" attribute
-		for (size_t i = auxiliaryAttributeBeginIndex; i < GetAttributes().Size(); ++i)
+		const OrderedVector& attributes = GetAttributes();
+		const size_t auxiliaryAttributeBeginIndex = TypeManager::GetDescriptor(TypeIdInstance()).PrescribedCount();
+		for (size_t i = auxiliaryAttributeBeginIndex; i < attributes.Size(); ++i)
 		{
-			func(*GetAttributes()[i]);
+			func(*attributes[i]);
 		}
 	}
 
 	void Attributed::Populate(std::size_t typeId)
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(typeId);
-
-		for (auto& sig : signatures)
+		// the prototype already has every attribute typed and in place, only the storage is left to point at this instance
+		const TypeManager::TypeDescriptor& descriptor = TypeManager::GetDescriptor(typeId);
+		const Vector<Signature>& signatures = descriptor.Signatures();
+		CopyLayout(descriptor.Prototype());
+
+		const OrderedVector& attributes = GetOrderedVector();
+		attributes[0]->second = this;
+		for (std::size_t i = 0; i < signatures.Size(); ++i)
 		{
-			Datum& datum = Append(sig.mName);
-			datum.SetType(sig.mType);
+			const Signature& sig = signatures[i];
 
-			// set all storage to be external except Type Tables
-			if (sig.mType != Datum::DatumTypes::Table)
+			// set all storage to be external except Type Tables, pooled attributes get theirs from the pool
+			if (sig.mType != Datum::DatumTypes::Table && sig.mOffset != Signature::Pooled)
 			{
-				void* offset = reinterpret_cast<uint8_t*>(this) + sig.mOffset;			
-				datum.SetStorage(offset, sig.mSize);
-			}
-			else
-			{
-				if(sig.mSize > 0) datum.Reserve(sig.mSize);
+				void* offset = reinterpret_cast<uint8_t*>(this) + sig.mOffset;
+				attributes[i + 1]->second.SetStorage(offset, sig.mSize);
 			}
 		}
+
+		AcquirePooledStorage(typeId, nullptr);
 	}
 
 	void Attributed::UpdateExternalStorage(std::size_t typeId)
 	{
-		Vector<Signature> signatures = TypeManager::GetSignatures(typeId);
+		const TypeManager::TypeDescriptor& descriptor = TypeManager::GetDescriptor(typeId);
+		const Vector<Signature>& signatures = descriptor.Signatures();
 
-		for (auto& sig : signatures)
+		for (std::size_t i = 0; i < signatures.Size(); ++i)
 		{
-			Datum* datum = Find(sig.mName);
+			const Signature& sig = signatures[i];
+			Datum* datum = Find(descriptor.Names()[i]);
 			if (datum == nullptr)
 			{
 				throw std::runtime_error("Signature Name was not found.");
 			}
 			datum->SetType(sig.mType);
 
-			// set all storage to be external except Type Tables
+			// set all storage to be external except Type Tables, pooled attributes are left to the pool
+			if (sig.mOffset == Signature::Pooled)
+			{
+				continue;
+			}
+
 			if (sig.mType != Datum::DatumTypes::Table)
 			{
 				void* offset = reinterpret_cast<uint8_t*>(this) + sig.mOffset;
@@ -223,4 +242,31 @@ namespace Library
 		}
 	}
 
+	void Attributed::AcquirePooledStorage(std::size_t typeId, const Attributed* source)
+	{
+		AttributePool& pool = TypeManager::GetPool(typeId);
+		if (pool.ColumnCount() == 0)
+		{
+			return;
+		}
+
+		pool.Acquire(*this, source);
+	}
+
+	void Attributed::TakePooledStorage(Attributed& rhs)
+	{
+		// the moved datums already point at rhs's row
+		if (rhs.mPool != nullptr)
+		{
+			rhs.mPool->Transfer(rhs, *this);
+		}
+	}
+
+	void Attributed::ReleasePooledStorage()
+	{
+		if (mPool != nullptr)
+		{
+			mPool->Release(*this);
+		}
+	}
 }
\ No newline at end of file
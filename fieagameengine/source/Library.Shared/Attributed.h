@@ -4,6 +4,8 @@
 
 namespace Library
 {
+	class AttributePool;
+
 	class Attributed : public Scope
 	{
 		RTTI_DECLARATIONS(Attributed, Scope)
@@ -14,7 +16,7 @@ namespace Library
 		Attributed(Attributed&& rhs) noexcept;
 		Attributed& operator=(const Attributed& rhs);
 		Attributed& operator=(Attributed&& rhs) noexcept;
-		virtual ~Attributed() = default;
+		virtual ~Attributed();
 
 #pragma region Equality:
 
@@ -37,6 +39,12 @@ namespace Library
 		/// <returns></returns>
 		bool IsPrescribedAttribute(const std::string& name) const;
 		/// <summary>
+		/// Symbol version of IsPrescribedAttribute, a lookup in the type's TypeDescriptor
+		/// </summary>
+		/// <param name="name">interned name</param>
+		/// <returns>true for "this" and the type's signatures</returns>
+		bool IsPrescribedAttribute(const Symbol& name) const;
+		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="name"></param>
@@ -79,11 +87,33 @@ namespace Library
 		explicit Attributed(std::size_t typeId);
 
 		/// <summary>
-		/// 
+		/// Gives a new instance its prescribed attributes: copies the type's prototype layout in bulk,
+		/// then points the datums at this instance's members (at its AttributePool row for pooled signatures)
 		/// </summary>
-		/// <param name="typeId"></param>
+		/// <param name="typeId">registered type of the instance</param>
 		void Populate(std::size_t typeId);
 
 		void UpdateExternalStorage(std::size_t typeId);
+
+	private:
+		/// <summary>
+		/// Takes a row in the type's AttributePool for the pooled prescribed attributes, if the type has any
+		/// </summary>
+		/// <param name="typeId">registered type of the instance</param>
+		/// <param name="source">instance whose pooled values are copied into the row, nullptr for default values</param>
+		void AcquirePooledStorage(std::size_t typeId, const Attributed* source);
+		/// <summary>
+		/// Takes over the row of a moved instance
+		/// </summary>
+		/// <param name="rhs">moved instance, left without a row</param>
+		void TakePooledStorage(Attributed& rhs);
+		/// <summary>
+		/// Gives the row back to the pool
+		/// </summary>
+		void ReleasePooledStorage();
+
+		friend class AttributePool;
+		AttributePool* mPool{ nullptr };
+		std::size_t mPoolRow{ 0 };
 	};
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "pch.h"
+#include "CallFrame.h"
+#include "TypeManager.h"
+
+namespace Library
+{
+	CallFrame::CallFrame(const Attributed& arguments) :
+		mArguments(&arguments), mAuxiliaryBegin(TypeManager::GetDescriptor(arguments.TypeIdInstance()).PrescribedCount())
+	{
+	}
+
+	const Datum* CallFrame::Find(const Symbol& key) const
+	{
+		for (const auto& [name, written] : mWritten)
+		{
+			if (name == key)
+			{
+				return &written;
+			}
+		}
+
+		const Datum* found = mArguments->Find(key);
+		if (found != nullptr)
+		{
+			// prescribed attributes come first, only those few are checked, not the arguments
+			const auto& attributes = mArguments->GetAttributes();
+			for (std::size_t i = 0; i < mAuxiliaryBegin && i < attributes.Size(); ++i)
+			{
+				if (&attributes[i]->second == found)
+				{
+					return nullptr;
+				}
+			}
+		}
+
+		return found;
+	}
+
+	Datum* CallFrame::FindWritable(const Symbol& key)
+	{
+		for (auto& [name, written] : mWritten)
+		{
+			if (name == key)
+			{
+				return &written;
+			}
+		}
+
+		const Datum* argument = Find(key);
+		if (argument == nullptr)
+		{
+			return nullptr;
+		}
+
+		// list nodes stay put, a copy handed out earlier is not moved by the next one
+		mWritten.PushFront({ key, *argument });
+		return &mWritten.Front().second;
+	}
+
+	const Attributed& CallFrame::Arguments() const
+	{
+		return *mArguments;
+	}
+}
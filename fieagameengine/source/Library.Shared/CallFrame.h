@@ -0,0 +1,76 @@
+#pragma once
+#include <utility>
+#include "Attributed.h"
+#include "SList.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Frame of the WorldState call stack, a view of the arguments an action list was called with.
+	/// Only the auxiliary attributes of the arguments are visible through it. Nothing is copied up front,
+	/// so pushing a frame costs the same however many arguments there are; an argument is copied into the frame
+	/// the first time it is asked for to write to, the arguments themselves are never written.
+	/// The arguments must outlive the frame.
+	/// </summary>
+	class CallFrame final
+	{
+	public:
+		/// <summary>
+		/// Constructor
+		/// </summary>
+		/// <param name="arguments">attributed whose auxiliary attributes are the arguments, not owned</param>
+		explicit CallFrame(const Attributed& arguments);
+		/// <summary>
+		/// Copy Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a const CallFrame reference</param>
+		CallFrame(const CallFrame& rhs) = default;
+		/// <summary>
+		/// Move Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a CallFrame&&</param>
+		CallFrame(CallFrame&& rhs) noexcept = default;
+		/// <summary>
+		/// Copy Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a const CallFrame reference</param>
+		/// <returns>Copied CallFrame</returns>
+		CallFrame& operator=(const CallFrame& rhs) = default;
+		/// <summary>
+		/// Move Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a CallFrame&&</param>
+		/// <returns>Moved CallFrame</returns>
+		CallFrame& operator=(CallFrame&& rhs) noexcept = default;
+		/// <summary>
+		/// Destructor
+		/// </summary>
+		~CallFrame() = default;
+
+		/// <summary>
+		/// Finds an argument, the prescribed attributes of the arguments are not arguments themselves
+		/// </summary>
+		/// <param name="key">interned argument name</param>
+		/// <returns>the argument, nullptr if there is none by that name</returns>
+		const Datum* Find(const Symbol& key) const;
+		/// <summary>
+		/// Finds an argument to write to. The first time, the argument is copied into the frame:
+		/// the actions of this call see what was written, the other reactions of the event do not.
+		/// Nested scopes of a table argument are not copied
+		/// </summary>
+		/// <param name="key">interned argument name</param>
+		/// <returns>the frame's copy of the argument, nullptr if there is none by that name</returns>
+		Datum* FindWritable(const Symbol& key);
+
+		/// <summary>
+		/// Gets the attributed the arguments are read from
+		/// </summary>
+		/// <returns>the arguments</returns>
+		const Attributed& Arguments() const;
+
+	private:
+		const Attributed* mArguments;
+		std::size_t mAuxiliaryBegin;
+		SList<std::pair<Symbol, Datum>> mWritten;
+	};
+}
@@ -59,7 +59,7 @@ namespace Library
 		rhs.mDataType = DatumTypes::Unknown;
 		rhs.mIsInternalStorage = true;
 		rhs.mData.voidPtr = nullptr;
-		rhs.mIncrementFunctor = DefaultIncrement<DatumValue>();
+		rhs.mIncrementFunctor = nullptr;
 	}
 
 	Datum& Datum::operator=(const Datum& rhs)
@@ -200,11 +200,11 @@ namespace Library
 			{
 				if (mDataType == DatumTypes::String)
 				{
-					free(mData.s);
+					Memory::Free(mData.s);
 				}
 				else
 				{
-					free(mData.voidPtr);
+					Memory::Free(mData.voidPtr);
 				}
 			}
 
@@ -220,7 +220,7 @@ namespace Library
 			rhs.mDataType = DatumTypes::Unknown;
 			rhs.mIsInternalStorage = true;
 			rhs.mData.voidPtr = nullptr;
-			rhs.mIncrementFunctor = DefaultIncrement<DatumValue>();
+			rhs.mIncrementFunctor = nullptr;
 		}
 
 		return *this;
@@ -234,11 +234,11 @@ namespace Library
 		{
 			if (mDataType == DatumTypes::String)
 			{
-				free(mData.s);
+				Memory::Free(mData.s);
 			}
 			else
 			{
-				free(mData.voidPtr);
+				Memory::Free(mData.voidPtr);
 			}
 			mSize = 0;
 			mCapacity = 0;
@@ -293,7 +293,7 @@ namespace Library
 		{
 			mCapacity = capacity;
 
-			void* data = (realloc(mData.voidPtr, mCapacity * DatumSizes[static_cast<size_t>(mDataType)]));
+			void* data = (Memory::Reallocate(mData.voidPtr, mCapacity * DatumSizes[static_cast<size_t>(mDataType)]));
 			assert(data != nullptr);
 			mData.voidPtr = data;
 		}
@@ -1031,7 +1031,7 @@ namespace Library
 
 		if (mSize == mCapacity)
 		{
-			Reserve(mCapacity + std::max(mIncrementFunctor(mSize, mCapacity), size_t(1)));
+			Reserve(mCapacity + std::max(Increment(), size_t(1)));
 		}
 	}
 }
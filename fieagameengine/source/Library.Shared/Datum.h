@@ -15,6 +15,8 @@
 #include "RTTI.h"
 #include "Enum.h"
 #include "DefaultIncrement.h"
+#include "FunctorPolicy.h"
+#include "Memory.h"
 #include "hashmap.h"
 
 
@@ -42,7 +44,11 @@ namespace Library
 		};
 
 	public:
-		using IncrementFunctor = std::function<size_t(const size_t, const size_t)>;
+		/// <summary>
+		/// Datum is not a template, so its growth strategy is always type-erased.
+		/// An empty functor (the default) means DefaultIncrement, which is called directly and inlines.
+		/// </summary>
+		using IncrementFunctor = IncrementFunction;
 		using RTTIPtr = RTTI*;
 		using ScopePtr = Scope*;
 
@@ -70,7 +76,7 @@ namespace Library
 		explicit Datum(DatumTypes dataType = DatumTypes::Unknown,
 			bool isInternalStorage = true,
 			size_t capacity = 0,
-			IncrementFunctor incrementFunctor = DefaultIncrement<DatumValue>());
+			IncrementFunctor incrementFunctor = nullptr);
 
 		/// <summary>
 		/// Copy Constructor
@@ -340,6 +346,11 @@ namespace Library
 		void PushBackHelper(const T& value);
 
 		void InitPushBack(DatumTypes type);
+
+		/// <summary>
+		/// Helper function to get how much to grow by when full, skips the std::function call for the default strategy
+		/// </summary>
+		size_t Increment() const;
 		
 		template<typename T>
 		std::tuple<size_t, bool> FindHelper(const T& value);
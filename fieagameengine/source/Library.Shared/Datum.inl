@@ -80,7 +80,7 @@ namespace Library
 
 		mCapacity = size;
 
-		void* data = (realloc(mData.voidPtr, mCapacity * DatumSizes[static_cast<size_t>(mDataType)]));
+		void* data = (Memory::Reallocate(mData.voidPtr, mCapacity * DatumSizes[static_cast<size_t>(mDataType)]));
 		assert(data != nullptr);
 		mData.voidPtr = data;
 	}
@@ -143,6 +143,11 @@ namespace Library
 
 	#pragma region Modifiers:
 	
+	inline size_t Datum::Increment() const
+	{
+		return (mIncrementFunctor ? mIncrementFunctor(mSize, mCapacity) : DefaultIncrement<DatumValue>()(mSize, mCapacity));
+	}
+
 	template<typename T>
 	inline void Datum::PushBackHelper(const T& value)
 	{
@@ -155,7 +160,7 @@ namespace Library
 
 		if (mSize == mCapacity)
 		{
-			Reserve( mCapacity + std::max( mIncrementFunctor( mSize, mCapacity ), size_t(1) ) );
+			Reserve( mCapacity + std::max( Increment(), size_t(1) ) );
 		}
 
 		if constexpr (std::is_same<T, std::int32_t>::value) new (mData.i + mSize) T(value);
@@ -1,10 +1,27 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
 
 namespace Library
 {
+	/// <summary>
+	/// Sums every byte times 17, anagrams always collide. Still used for non-string keys; kept for comparison
+	/// </summary>
 	std::size_t AdditiveHash(const std::uint8_t* key, std::size_t length);
+	/// <summary>
+	/// wyhash-style hash for byte strings, used by the string and char* specializations.
+	/// Keys of 256 bytes or more go through an xxHash3-style striped accumulator with an SSE2 path
+	/// (define FIEA_HASH_NO_SIMD to force the scalar path, both give the same result)
+	/// </summary>
+	std::size_t StringHash(const std::uint8_t* key, std::size_t length);
+	/// <summary>
+	/// splitmix64 finalizer over an address, used by the pointer specializations.
+	/// Addresses share their alignment bits and most of their high bits, summed bytes would put them in a handful of buckets
+	/// </summary>
+	std::size_t PointerHash(const void* key);
 
 	template <typename T>
 	struct DefaultHash final
@@ -13,6 +30,18 @@ namespace Library
 
 	};
 
+	template <typename T>
+	struct DefaultHash<T*> final
+	{
+		std::size_t operator()(const T* key) const;
+	};
+
+	template <typename T>
+	struct DefaultHash<T* const> final
+	{
+		std::size_t operator()(const T* key) const;
+	};
+
 	template <>
 	struct DefaultHash<char*> final
 	{
@@ -48,6 +77,18 @@ namespace Library
 	{
 		std::size_t operator()(const std::string& key) const;
 	};
+
+	template <>
+	struct DefaultHash<std::string_view> final
+	{
+		std::size_t operator()(std::string_view key) const;
+	};
+
+	template <>
+	struct DefaultHash<const std::string_view> final
+	{
+		std::size_t operator()(std::string_view key) const;
+	};
 }
 
 #include "DefaultHash.inl"
\ No newline at end of file
@@ -1,5 +1,14 @@
 #include "DefaultHash.h"
 
+#if !defined(FIEA_HASH_NO_SIMD) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define FIEA_HASH_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 namespace Library
 {
 	template<typename T>
@@ -9,40 +18,75 @@ namespace Library
 		return AdditiveHash(data, sizeof(T));
 	}
 
+	template<typename T>
+	inline std::size_t DefaultHash<T*>::operator()(const T* key) const
+	{
+		return PointerHash(key);
+	}
+
+	template<typename T>
+	inline std::size_t DefaultHash<T* const>::operator()(const T* key) const
+	{
+		return PointerHash(key);
+	}
+
 	inline std::size_t DefaultHash<char*>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return StringHash(data, strlen(key));
 	}
 
 	inline std::size_t DefaultHash<const char*>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return StringHash(data, strlen(key));
 	}
 
 	inline std::size_t DefaultHash<char* const>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return StringHash(data, strlen(key));
 	}
 
 	inline std::size_t DefaultHash<const char* const>::operator()(const char* const key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-		return AdditiveHash(data, strlen(key));
+		return StringHash(data, strlen(key));
 	}
 
 	inline std::size_t DefaultHash<std::string>::operator()(const std::string& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-		return AdditiveHash(data, key.length());
+		return StringHash(data, key.length());
 	}
 
 	inline std::size_t DefaultHash<const std::string>::operator()(const std::string& key) const
 	{
 		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-		return AdditiveHash(data, key.length());
+		return StringHash(data, key.length());
+	}
+
+	inline std::size_t DefaultHash<std::string_view>::operator()(std::string_view key) const
+	{
+		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.data());
+		return StringHash(data, key.length());
+	}
+
+	inline std::size_t DefaultHash<const std::string_view>::operator()(std::string_view key) const
+	{
+		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.data());
+		return StringHash(data, key.length());
+	}
+
+	inline std::size_t PointerHash(const void* key)
+	{
+		std::uint64_t hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key));
+		hash ^= hash >> 30;
+		hash *= 0xbf58476d1ce4e5b9ull;
+		hash ^= hash >> 27;
+		hash *= 0x94d049bb133111ebull;
+		hash ^= hash >> 31;
+		return static_cast<std::size_t>(hash);
 	}
 
 	inline std::size_t AdditiveHash(const uint8_t* key, size_t length)
@@ -56,4 +100,242 @@ namespace Library
 		return hash;
 	}
 
+#pragma region StringHash
+
+	namespace HashHelpers
+	{
+		inline constexpr std::uint64_t Prime0 = 0xa0761d6478bd642full;
+		inline constexpr std::uint64_t Prime1 = 0xe7037ed1a0b428dbull;
+		inline constexpr std::uint64_t Prime2 = 0x8ebc6af09c88c6e3ull;
+		inline constexpr std::uint64_t Prime3 = 0x589965cc75374cc3ull;
+
+		inline constexpr std::size_t LongKeyLength = 256;
+		inline constexpr std::size_t StripeLength = 64;
+		inline constexpr std::size_t StripesPerBlock = 16;
+
+		alignas(16) inline constexpr std::uint64_t Secret[8] =
+		{
+			0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull,
+			0x78e5c0cc4ee679cbull, 0x2172ffcc7dd05a82ull, 0x8e2443f7744608b8ull, 0x4c263a81e69035e0ull
+		};
+
+		inline std::uint64_t Read64(const std::uint8_t* data)
+		{
+			std::uint64_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read32(const std::uint8_t* data)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		/// <summary>
+		/// 64x64 -> 128 bit multiply folded back to 64 bits (high ^ low)
+		/// </summary>
+		inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			std::uint64_t high;
+			std::uint64_t low = _umul128(a, b, &high);
+			return low ^ high;
+#elif defined(__SIZEOF_INT128__)
+			unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+			return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+			const std::uint64_t aLow = a & 0xffffffffull, aHigh = a >> 32;
+			const std::uint64_t bLow = b & 0xffffffffull, bHigh = b >> 32;
+			const std::uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+			const std::uint64_t cross = (lowLow >> 32) + (lowHigh & 0xffffffffull) + highLow;
+			const std::uint64_t low = (cross << 32) | (lowLow & 0xffffffffull);
+			const std::uint64_t high = highHigh + (lowHigh >> 32) + (cross >> 32);
+			return low ^ high;
+#endif
+		}
+
+		/// <summary>
+		/// One 64 byte stripe into the 8 lane accumulator: lane i gets lo32 * hi32 of (data ^ secret), its neighbour gets the raw data
+		/// </summary>
+		inline void AccumulateStripe(std::uint64_t* accumulator, const std::uint8_t* stripe)
+		{
+			for (std::size_t lane = 0; lane < 8; ++lane)
+			{
+				const std::uint64_t data = Read64(stripe + lane * 8);
+				const std::uint64_t keyed = data ^ Secret[lane];
+				accumulator[lane ^ 1] += data;
+				accumulator[lane] += (keyed & 0xffffffffull) * (keyed >> 32);
+			}
+		}
+
+		/// <summary>
+		/// Runs a number of whole stripes through the accumulator one lane at a time
+		/// </summary>
+		inline void AccumulateStripesScalar(std::uint64_t* accumulator, const std::uint8_t* data, std::size_t stripeCount)
+		{
+			for (std::size_t stripe = 0; stripe < stripeCount; ++stripe)
+			{
+				AccumulateStripe(accumulator, data + stripe * StripeLength);
+			}
+		}
+
+#ifdef FIEA_HASH_SSE2
+		/// <summary>
+		/// Runs a number of whole stripes through the accumulator, two lanes per SSE2 register
+		/// </summary>
+		inline void AccumulateStripesSse2(std::uint64_t* accumulator, const std::uint8_t* data, std::size_t stripeCount)
+		{
+			__m128i* lanes = reinterpret_cast<__m128i*>(accumulator);
+			const __m128i* secret = reinterpret_cast<const __m128i*>(Secret);
+
+			for (std::size_t stripe = 0; stripe < stripeCount; ++stripe)
+			{
+				const __m128i* input = reinterpret_cast<const __m128i*>(data + stripe * StripeLength);
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					const __m128i dataVector = _mm_loadu_si128(input + i);
+					const __m128i keyed = _mm_xor_si128(dataVector, _mm_load_si128(secret + i));
+					const __m128i keyedHigh = _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1));
+					const __m128i product = _mm_mul_epu32(keyed, keyedHigh);
+					const __m128i swapped = _mm_shuffle_epi32(dataVector, _MM_SHUFFLE(1, 0, 3, 2));
+					lanes[i] = _mm_add_epi64(lanes[i], _mm_add_epi64(product, swapped));
+				}
+			}
+		}
+#endif
+
+		/// <summary>
+		/// Runs a number of whole stripes through the accumulator, on SSE2 when available
+		/// </summary>
+		inline void AccumulateStripes(std::uint64_t* accumulator, const std::uint8_t* data, std::size_t stripeCount)
+		{
+#ifdef FIEA_HASH_SSE2
+			AccumulateStripesSse2(accumulator, data, stripeCount);
+#else
+			AccumulateStripesScalar(accumulator, data, stripeCount);
+#endif
+		}
+
+		using AccumulateFunction = void (*)(std::uint64_t*, const std::uint8_t*, std::size_t);
+
+		inline void Scramble(std::uint64_t* accumulator)
+		{
+			for (std::size_t lane = 0; lane < 8; ++lane)
+			{
+				std::uint64_t value = accumulator[lane];
+				value ^= value >> 47;
+				value ^= Secret[lane];
+				accumulator[lane] = value * 0x9E3779B1ull;
+			}
+		}
+
+		/// <summary>
+		/// Striped hash of a key of at least LongKeyLength bytes, Accumulate picks the path so both can be compared
+		/// </summary>
+		template <AccumulateFunction Accumulate = AccumulateStripes>
+		inline std::uint64_t LongHash(const std::uint8_t* key, std::size_t length)
+		{
+			alignas(16) std::uint64_t accumulator[8] = { Prime0, Prime1, Prime2, Prime3, Secret[4], Secret[5], Secret[6], Secret[7] };
+
+			const std::size_t blockLength = StripeLength * StripesPerBlock;
+			const std::size_t blockCount = (length - 1) / blockLength;
+			for (std::size_t block = 0; block < blockCount; ++block)
+			{
+				Accumulate(accumulator, key + block * blockLength, StripesPerBlock);
+				Scramble(accumulator);
+			}
+
+			// whole stripes left in the last block, then the final 64 bytes (which may overlap the previous stripe)
+			const std::size_t remaining = length - blockCount * blockLength;
+			const std::size_t stripeCount = (remaining - 1) / StripeLength;
+			Accumulate(accumulator, key + blockCount * blockLength, stripeCount);
+			AccumulateStripe(accumulator, key + length - StripeLength);
+
+			std::uint64_t hash = length * 0x9E3779B185EBCA87ull;
+			for (std::size_t lane = 0; lane < 8; lane += 2)
+			{
+				hash += Mix(accumulator[lane] ^ Prime1, accumulator[lane + 1] ^ Secret[lane]);
+			}
+
+			hash ^= hash >> 37;
+			hash *= 0x165667919E3779F9ull;
+			hash ^= hash >> 32;
+			return hash;
+		}
+
+		inline std::uint64_t ShortHash(const std::uint8_t* key, std::size_t length)
+		{
+			std::uint64_t seed = Prime0;
+			std::uint64_t a;
+			std::uint64_t b;
+
+			if (length <= 16)
+			{
+				if (length >= 4)
+				{
+					const std::size_t offset = (length >> 3) << 2;
+					a = (Read32(key) << 32) | Read32(key + offset);
+					b = (Read32(key + length - 4) << 32) | Read32(key + length - 4 - offset);
+				}
+				else if (length > 0)
+				{
+					a = (static_cast<std::uint64_t>(key[0]) << 16) | (static_cast<std::uint64_t>(key[length >> 1]) << 8) | key[length - 1];
+					b = 0;
+				}
+				else
+				{
+					a = b = 0;
+				}
+			}
+			else
+			{
+				const std::uint8_t* data = key;
+				std::size_t left = length;
+				if (left > 48)
+				{
+					std::uint64_t seed1 = seed;
+					std::uint64_t seed2 = seed;
+					do
+					{
+						seed = Mix(Read64(data) ^ Prime1, Read64(data + 8) ^ seed);
+						seed1 = Mix(Read64(data + 16) ^ Prime2, Read64(data + 24) ^ seed1);
+						seed2 = Mix(Read64(data + 32) ^ Prime3, Read64(data + 40) ^ seed2);
+						data += 48;
+						left -= 48;
+					} while (left > 48);
+					seed ^= seed1 ^ seed2;
+				}
+
+				while (left > 16)
+				{
+					seed = Mix(Read64(data) ^ Prime1, Read64(data + 8) ^ seed);
+					data += 16;
+					left -= 16;
+				}
+
+				a = Read64(data + left - 16);
+				b = Read64(data + left - 8);
+			}
+
+			return Mix(Prime1 ^ length, Mix(a ^ Prime1, b ^ seed));
+		}
+	}
+
+	inline std::size_t StringHash(const std::uint8_t* key, std::size_t length)
+	{
+		const std::uint64_t hash = (length < HashHelpers::LongKeyLength ? HashHelpers::ShortHash(key, length) : HashHelpers::LongHash(key, length));
+
+		if constexpr (sizeof(std::size_t) < sizeof(std::uint64_t))
+		{
+			return static_cast<std::size_t>(hash ^ (hash >> 32));
+		}
+		else
+		{
+			return static_cast<std::size_t>(hash);
+		}
+	}
+
+#pragma endregion StringHash
 }
\ No newline at end of file
@@ -34,7 +34,7 @@ namespace Library
 
 	Sector* Entity::GetSector() const
 	{
-		assert(GetParent()->Is(Sector::TypeIdClass()));
+		assert(GetParent()->Is<Sector>());
 		return static_cast<Sector*>(GetParent());
 	}
 
@@ -79,7 +79,7 @@ namespace Library
 		for (uint32_t i = 0; i < actions.Size(); ++i)
 		{
 			Scope& actionScope = actions[i];
-			assert(actionScope.Is(Action::TypeIdClass()));
+			assert(actionScope.Is<Action>());
 
 			Action& tempAction = static_cast<Action&>(actionScope);
 			worldState.action = &tempAction;
@@ -77,8 +77,7 @@ namespace Library
 
 	private:
 		T mPayload;
-		static std::mutex mMutex;
-		static Vector<IEventSubscriber*> mSubscribersList;
+		static SubscriberList mSubscribersList;
 	};
 }
 
@@ -8,53 +8,41 @@ namespace Library
 	RTTI_DEFINITIONS(Event<T>)
 
 	template<typename T>
-	std::mutex Event<T>::mMutex;
-	
-	template<typename T>
-	Vector<IEventSubscriber*> Event<T>::mSubscribersList;
+	IEventPublisher::SubscriberList Event<T>::mSubscribersList;
 
 	template<typename T>
 	Event<T>::Event(const T& payload) : 
-		IEventPublisher(mSubscribersList, mMutex), mPayload(payload)
+		IEventPublisher(mSubscribersList), mPayload(payload)
 	{
 	}
 
 	template<typename T>
 	inline Event<T>::Event(T&& payload) :
-		IEventPublisher(mSubscribersList, mMutex), mPayload(std::move(payload))
+		IEventPublisher(mSubscribersList), mPayload(std::move(payload))
 	{
 	}
 
 	template<typename T>
 	inline void Event<T>::Subscribe(IEventSubscriber& subscriber)
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-
-		mSubscribersList.PushBack(&subscriber);
+		IEventPublisher::Subscribe(mSubscribersList, subscriber);
 	}
 
 	template<typename T>
 	inline void Event<T>::Unsubscribe(IEventSubscriber& subscriber)
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-				
-		mSubscribersList.Remove(&subscriber);		
+		IEventPublisher::Unsubscribe(mSubscribersList, subscriber);
 	}
 
 	template<typename T>
 	inline void Event<T>::UnsubscribeAll()
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-
-		mSubscribersList.Clear();
-		mSubscribersList.ShrinkToFit();
+		IEventPublisher::UnsubscribeAll(mSubscribersList);
 	}
 
 	template<typename T>
 	inline const T& Event<T>::Message() const
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-
 		return mPayload;
 	}
 }
\ No newline at end of file
@@ -1,98 +1,185 @@
 #include "pch.h"
 #include "EventQueue.h"
 #include "GameTime.h"
-#include <future>
+#include "JobSystem.h"
 
 namespace Library
 {
+	EventQueue::~EventQueue()
+	{
+		DrainPending(false);
+	}
+
 	void EventQueue::Enqueue(std::shared_ptr<IEventPublisher> event, const GameTime& gameTime, const MilliSeconds& delay)
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
+		PendingEvent* pending = new PendingEvent{ { std::move(event), gameTime.CurrentTime() + delay }, nullptr };
+
+		// counted before it is reachable, so the count never drops below what is actually on the list
+		mPendingCount.fetch_add(1, std::memory_order_relaxed);
 
-		mPendingEventQueue.PushBack({ std::move(event), gameTime.CurrentTime(), delay });
+		pending->Next = mPendingEvents.load(std::memory_order_relaxed);
+		while (!mPendingEvents.compare_exchange_weak(pending->Next, pending, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
 	}
 
 	void EventQueue::Send(const	std::shared_ptr<IEventPublisher>& event)
 	{
-		event->Deliver();
+		event->Deliver(mJobSystem);
 	}
 
 	void EventQueue::Update(const GameTime& gameTime)
 	{
-		if (!IsEmpty())
+		DrainPending(true);
+
+		// emptied however the delivery ends, a subscriber that throws must not get the same events again next Update
+		struct ExpiredEventsScope final
 		{
-			// add all pending events to main event queue
-			for (auto& event : mPendingEventQueue)
+			EventQueue& Queue;
+			~ExpiredEventsScope()
 			{
-				mEventQueue.PushBack(std::move(event));
+				Queue.mBatches.Resize(0);
+				Queue.mBatchedEvents.Resize(0);
+				Queue.mExpiredEvents.Resize(0);
 			}
-			mPendingEventQueue.Resize(0);
+		} expiredEvents{ *this };
 
-			// create predicate to pass into std::partition()
-			auto expression = [&gameTime](EnqueuedEvent event)
-			{
-				return (gameTime.CurrentTime() < (event.EnqueuedTime + event.Delay));
-			};
-
-			// Reorders the elements in the range [first, last) in such a way that all 
-			// elements for which the predicate returns true precede the elements for 
-			// which predicate returns false. Relative order of the elements is not preserved.
+		// expired events are on top of the heap, the first one still waiting ends the search
+		while (!mEventQueue.IsEmpty() && mEventQueue.Top().ExpiryTime <= gameTime.CurrentTime())
+		{
+			mExpiredEvents.PushBack(mEventQueue.PopTop().EventPublisherPtr);
+		}
+		mQueuedCount.store(mEventQueue.Size(), std::memory_order_relaxed);
 
-			auto partitionElement = std::partition(mEventQueue.begin(), mEventQueue.end(), expression);
+		if (mExpiredEvents.IsEmpty())
+		{
+			return;
+		}
 
-			if (partitionElement != mEventQueue.end())
+		// deliver all expired events, each subscriber once per type, subscribers may enqueue new ones meanwhile;
+		// on the job system when there is one
+		BatchExpiredEvents();
+		if (mJobSystem == nullptr)
+		{
+			for (const EventBatch& batch : mBatches)
 			{
-				// iterate through all expired events and call deliver() on them, async-ly
-				std::vector<std::future<void>> futures;
-				
-				for (auto it = partitionElement; it != mEventQueue.end(); ++it)
-				{
-					auto& expiredEvent = (*it).EventPublisherPtr;
-					futures.emplace_back(std::async(std::launch::async, [&expiredEvent]()
-					{
-						expiredEvent->Deliver();
-					}));
-				}
-				
-				for (auto& f : futures)
-				{
-					f.get();
-				}
-												
-				// resize the vector remove expired events
-				auto end = mEventQueue.end() - 1;
-				mEventQueue.Remove(partitionElement, end);
+				IEventPublisher::DeliverBatch(&mBatchedEvents[batch.Begin], batch.Count);
 			}
 		}
+		else
+		{
+			mJobSystem->ParallelFor(mBatches.Size(), [this](std::size_t index, std::size_t)
+			{
+				const EventBatch& batch = mBatches[index];
+				IEventPublisher::DeliverBatch(&mBatchedEvents[batch.Begin], batch.Count, mJobSystem);
+			});
+		}
 	}
 
 	void EventQueue::Clear()
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-
-		mPendingEventQueue.Clear();
+		DrainPending(false);
 		mEventQueue.Clear();
+		mQueuedCount.store(0, std::memory_order_relaxed);
 	}
 
 	bool EventQueue::IsEmpty() const
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
-
-		return mEventQueue.IsEmpty() && mPendingEventQueue.IsEmpty();
+		return Size() == 0;
 	}
 
 	std::size_t EventQueue::Size() const
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
+		return mQueuedCount.load(std::memory_order_relaxed) + mPendingCount.load(std::memory_order_relaxed);
+	}
 
-		return mEventQueue.Size() + mPendingEventQueue.Size();
+	void EventQueue::SetJobSystem(JobSystem* jobSystem)
+	{
+		mJobSystem = jobSystem;
 	}
 
-	void EventQueue::ShrinkToFit()
+	JobSystem* EventQueue::GetJobSystem() const
 	{
-		std::scoped_lock<std::mutex> lock(mMutex);
+		return mJobSystem;
+	}
 
+	bool EventQueue::ExpiresSooner::operator()(const EnqueuedEvent& lhs, const EnqueuedEvent& rhs) const
+	{
+		return lhs.ExpiryTime < rhs.ExpiryTime;
+	}
+
+	void EventQueue::ShrinkToFit()
+	{
 		mEventQueue.ShrinkToFit();
-		mPendingEventQueue.ShrinkToFit();
+		mExpiredEvents.ShrinkToFit();
+		mBatchedEvents.ShrinkToFit();
+		mBatches.ShrinkToFit();
+	}
+
+	void EventQueue::BatchExpiredEvents()
+	{
+		// count the events of each type first, a handful of types at most so a linear search does
+		for (const auto& expiredEvent : mExpiredEvents)
+		{
+			++FindBatch(expiredEvent->TypeIdInstance()).Count;
+		}
+
+		std::size_t begin = 0;
+		for (EventBatch& batch : mBatches)
+		{
+			batch.Begin = begin;
+			begin += batch.Count;
+			batch.Count = 0;
+		}
+
+		// then place them, the expired events are already in expiry order
+		mBatchedEvents.Resize(mExpiredEvents.Size());
+		for (const auto& expiredEvent : mExpiredEvents)
+		{
+			EventBatch& batch = FindBatch(expiredEvent->TypeIdInstance());
+			mBatchedEvents[batch.Begin + batch.Count] = expiredEvent.get();
+			++batch.Count;
+		}
+	}
+
+	EventQueue::EventBatch& EventQueue::FindBatch(RTTI::IdType typeId)
+	{
+		for (EventBatch& batch : mBatches)
+		{
+			if (batch.TypeId == typeId)
+			{
+				return batch;
+			}
+		}
+
+		mBatches.PushBack({ typeId, 0, 0 });
+		return mBatches.Back();
+	}
+
+	void EventQueue::DrainPending(bool keep)
+	{
+		// producers keep pushing onto the now empty list while this one is worked through
+		PendingEvent* pending = mPendingEvents.exchange(nullptr, std::memory_order_acquire);
+
+		std::size_t count = 0;
+		while (pending != nullptr)
+		{
+			if (keep)
+			{
+				mEventQueue.Push(std::move(pending->Event));
+			}
+
+			PendingEvent* next = pending->Next;
+			delete pending;
+			pending = next;
+			++count;
+		}
+
+		// the heap's count goes up before the intake's goes down, so Size never dips in between
+		if (keep)
+		{
+			mQueuedCount.store(mEventQueue.Size(), std::memory_order_relaxed);
+		}
+		mPendingCount.fetch_sub(count, std::memory_order_relaxed);
 	}
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include "IEventPublisher.h"
 #include "Vector.h"
+#include "PriorityQueue.h"
+#include <atomic>
 #include <chrono>
 
 using MilliSeconds = std::chrono::milliseconds;
@@ -8,9 +10,12 @@ using MilliSeconds = std::chrono::milliseconds;
 namespace Library
 {
 	class GameTime;
+	class JobSystem;
 
 	/// <summary>
-	/// EventQueue System to enqueue and send events to EventSubscribers
+	/// EventQueue System to enqueue and send events to EventSubscribers.
+	/// Enqueue, IsEmpty and Size may be called from any thread without blocking; Update, Clear and ShrinkToFit
+	/// belong to the thread that owns the queue.
 	/// </summary>
 	class EventQueue
 	{
@@ -48,12 +53,13 @@ namespace Library
 		/// <summary>
 		/// Destructor
 		/// </summary>
-		~EventQueue() = default;
+		~EventQueue();
 
 		/// <summary>
 		/// Given the address of an EventPublisher, 
 		/// a GameTime (used to retrieve the current time), 
 		/// and an optional delay time, enqueue the event.
+		/// Lock free, the event is pushed on an intake list that the next Update drains.
 		/// </summary>
 		/// <param name="event">address of an EventPublisher</param>
 		/// <param name="gameTime">GameTime</param>
@@ -68,6 +74,8 @@ namespace Library
 
 		/// <summary>
 		/// Given the a GameTime, publish any queued events that have expired.
+		/// Events wait in a min-heap on their expiry time, so only the ones that are due get touched.
+		/// Expired events are grouped by type, each subscriber gets all of a type's events in one NotifyBatch.
 		/// </summary>
 		/// <param name="game_time">GameTime</param>
 		void Update(const GameTime& game_time);
@@ -90,18 +98,75 @@ namespace Library
 		std::size_t Size() const;
 
 		void ShrinkToFit();
+
+		/// <summary>
+		/// Sets the job system expired events and their subscribers are delivered on.
+		/// Without one, Update and Send deliver in order on the calling thread
+		/// </summary>
+		/// <param name="jobSystem">job system, not owned, nullptr for in order delivery</param>
+		void SetJobSystem(JobSystem* jobSystem);
+		/// <summary>
+		/// Gets the job system events are delivered on
+		/// </summary>
+		/// <returns>job system, nullptr when delivering in order</returns>
+		JobSystem* GetJobSystem() const;
 		
 	private:
 		struct EnqueuedEvent
 		{
 			std::shared_ptr<IEventPublisher> EventPublisherPtr{ nullptr };
-			TimePoint EnqueuedTime;
-			MilliSeconds Delay{ MilliSeconds(0)};
+			TimePoint ExpiryTime;
+		};
+
+		/// <summary>
+		/// Node of the intake list producers push onto
+		/// </summary>
+		struct PendingEvent final
+		{
+			EnqueuedEvent Event;
+			PendingEvent* Next{ nullptr };
 		};
 
-		mutable std::mutex mMutex;
-		Vector<EnqueuedEvent> mEventQueue;
-		Vector<EnqueuedEvent> mPendingEventQueue;
+		/// <summary>
+		/// Orders the event queue so the event due first is on top
+		/// </summary>
+		struct ExpiresSooner final
+		{
+			bool operator()(const EnqueuedEvent& lhs, const EnqueuedEvent& rhs) const;
+		};
+
+		/// <summary>
+		/// Expired events of one type, a contiguous range of the batched events
+		/// </summary>
+		struct EventBatch final
+		{
+			RTTI::IdType TypeId{ 0 };
+			std::size_t Begin{ 0 };
+			std::size_t Count{ 0 };
+		};
+
+		/// <summary>
+		/// Takes the whole intake list at once, the heap gets every event that was pushed on it
+		/// </summary>
+		/// <param name="keep">false to delete the events instead</param>
+		void DrainPending(bool keep);
+		/// <summary>
+		/// Groups the expired events by type, each type's events back to back and still in expiry order
+		/// </summary>
+		void BatchExpiredEvents();
+		/// <summary>
+		/// Finds the batch of a type, appending it if it is the first event of that type
+		/// </summary>
+		EventBatch& FindBatch(RTTI::IdType typeId);
+
+		JobSystem* mJobSystem{ nullptr };
+		PriorityQueue<EnqueuedEvent, ExpiresSooner> mEventQueue;
+		std::atomic<PendingEvent*> mPendingEvents{ nullptr };
+		std::atomic<std::size_t> mPendingCount{ 0 };
+		std::atomic<std::size_t> mQueuedCount{ 0 };
+		Vector<std::shared_ptr<IEventPublisher>> mExpiredEvents;
+		Vector<const IEventPublisher*> mBatchedEvents;
+		Vector<EventBatch> mBatches;
 	};
 
 }
\ No newline at end of file
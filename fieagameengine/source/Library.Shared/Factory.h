@@ -1,12 +1,50 @@
 #pragma once
 
 #include "hashmap.h"
+#include "vector.h"
 #include <gsl/gsl>
+#include <mutex>
+#include <new>
+#include <type_traits>
 
 namespace Library
 {
+	/// <summary>
+	/// Whether recycled products of a class are pooled. A pooled product is default constructed while it waits,
+	/// so a class whose constructor reaches outside the product (registers it somewhere, say) specializes this to false:
+	/// its recycled products are deleted instead, they would be live while in the pool.
+	/// </summary>
+	template <typename ConcreteProductT>
+	struct IsPooledProduct final
+	{
+		static constexpr bool Value = true;
+	};
+
+	/// <summary>
+	/// Frees the memory of a product whose constructor threw, through the operator delete a new expression of the class would use
+	/// </summary>
+	template <typename ConcreteProductT, typename = void>
+	struct ProductMemory final
+	{
+		static void Free(void* data)
+		{
+			::operator delete(data);
+		}
+	};
+
+	template <typename ConcreteProductT>
+	struct ProductMemory<ConcreteProductT, std::void_t<decltype(ConcreteProductT::operator delete(static_cast<void*>(nullptr)))>> final
+	{
+		static void Free(void* data)
+		{
+			ConcreteProductT::operator delete(data);
+		}
+	};
+
 	/// <summary>
 	/// Templated Class using the Factory Design Pattern
+	/// Every concrete factory keeps a pool of reset products, handed out again by Create before anything new is allocated.
+	/// Products must declare their own RTTI, Recycle finds the factory of a product by its type id.
 	/// </summary>
 	template<typename AbstractProductT>
 	class Factory
@@ -33,9 +71,9 @@ namespace Library
 		/// </summary>
 		Factory& operator=(Factory&& rhs) noexcept = delete;
 		/// <summary>
-		/// Virtual Destructor
+		/// Virtual Destructor, deletes the pooled products
 		/// </summary>
-		virtual ~Factory() = default;
+		virtual ~Factory();
 
 		/// <summary>
 		/// (static) Given a class name (string), return the associated concrete factory
@@ -50,7 +88,28 @@ namespace Library
 		/// <param name="className">class name (string)</param>
 		/// <returns>new object of that type</returns>
 		static gsl::owner<AbstractProductT*> Create(const std::string& className);
-		
+
+		/// <summary>
+		/// (static) Given a product, return the class name its factory creates it by
+		/// </summary>
+		/// <param name="product">product of any class</param>
+		/// <returns>class name, empty if no factory makes products of its type</returns>
+		static std::string ClassNameOf(const AbstractProductT& product);
+
+		/// <summary>
+		/// (static) Takes back a product that is no longer used. It is reset and pooled by the factory of its type,
+		/// or deleted when there is no such factory or its class is not pooled (IsPooledProduct).
+		/// A product whose default constructor throws while it is reset is freed instead, Recycle does not throw for it.
+		/// </summary>
+		/// <param name="product">product to recycle, owned by the factory afterwards</param>
+		static void Recycle(gsl::owner<AbstractProductT*> product);
+
+		/// <summary>
+		/// Number of reset products waiting to be handed out by Create
+		/// </summary>
+		/// <returns>pool size</returns>
+		std::size_t PoolSize() const;
+
 
 	protected:
 		/// <summary>
@@ -65,6 +124,31 @@ namespace Library
 		/// <returns>name of the class</returns>
 		virtual const std::string ClassName() const = 0;
 
+		/// <summary>
+		/// Return the type id of the class the factory instantiates.
+		/// </summary>
+		/// <returns>type id of the class</returns>
+		virtual std::size_t ProductTypeId() const = 0;
+
+		/// <summary>
+		/// Destroys a product and constructs a default one in its place, so it can be pooled.
+		/// If the constructor throws, the product's memory is freed before the exception propagates.
+		/// </summary>
+		/// <param name="product">product of this factory's class</param>
+		virtual void Reset(AbstractProductT& product) = 0;
+
+		/// <summary>
+		/// Return whether the products of this factory's class are pooled when they are recycled
+		/// </summary>
+		/// <returns>IsPooledProduct of the class</returns>
+		virtual bool IsPooled() const = 0;
+
+		/// <summary>
+		/// Pops a pooled product
+		/// </summary>
+		/// <returns>a reset product, nullptr if there is none to hand out</returns>
+		gsl::owner<AbstractProductT*> Acquire();
+
 		/// <summary>
 		/// Given a reference to a concrete factory, add it to the list of factories for this abstract factory
 		/// </summary>
@@ -79,6 +163,10 @@ namespace Library
 		
 	private:
 		static Hashmap<const std::string, Factory<AbstractProductT>*> mConcreteFactoryTable;
+		static Hashmap<std::size_t, Factory<AbstractProductT>*> mTypeFactoryTable;
+
+		Vector<AbstractProductT*> mPool;
+		mutable std::mutex mPoolMutex;
 	};
 
 	/// <summary>
@@ -98,12 +186,36 @@ namespace Library
 		}																				\
 		virtual gsl::owner<AbstractProductT*> Create() override							\
 		{																				\
-			return new ConcreteProductT();												\
+			AbstractProductT* product = Acquire();										\
+			return (product != nullptr ? product : new ConcreteProductT());				\
 		}																				\
 		virtual const std::string ClassName() const override							\
 		{																				\
 			return (#ConcreteProductT);													\
 		}																				\
+		virtual std::size_t ProductTypeId() const override								\
+		{																				\
+			return ConcreteProductT::TypeIdClass();										\
+		}																				\
+	protected:																			\
+		virtual void Reset(AbstractProductT& product) override							\
+		{																				\
+			ConcreteProductT* concrete = static_cast<ConcreteProductT*>(&product);		\
+			concrete->~ConcreteProductT();												\
+			try																			\
+			{																			\
+				new (concrete) ConcreteProductT();										\
+			}																			\
+			catch (...)																	\
+			{																			\
+				ProductMemory<ConcreteProductT>::Free(concrete);						\
+				throw;																	\
+			}																			\
+		}																				\
+		virtual bool IsPooled() const override											\
+		{																				\
+			return IsPooledProduct<ConcreteProductT>::Value;							\
+		}																				\
 	};
 }
 
@@ -5,6 +5,18 @@ namespace Library
 	template <typename AbstractProductT>
 	Hashmap<const std::string, Factory<AbstractProductT>*> Factory<AbstractProductT>::mConcreteFactoryTable;
 
+	template <typename AbstractProductT>
+	Hashmap<std::size_t, Factory<AbstractProductT>*> Factory<AbstractProductT>::mTypeFactoryTable;
+
+	template <typename AbstractProductT>
+	inline Factory<AbstractProductT>::~Factory()
+	{
+		for (AbstractProductT* product : mPool)
+		{
+			delete product;
+		}
+	}
+
 	template <typename AbstractProductT>
 	inline const Factory<AbstractProductT>* Factory<AbstractProductT>::Find(const std::string& className)
 	{
@@ -23,17 +35,83 @@ namespace Library
 		return mConcreteFactoryTable.At(className)->Create();
 	}
 
+	template<typename AbstractProductT>
+	inline std::string Factory<AbstractProductT>::ClassNameOf(const AbstractProductT& product)
+	{
+		auto it = mTypeFactoryTable.Find(product.TypeIdInstance());
+		if (it == mTypeFactoryTable.end())
+		{
+			return std::string();
+		}
+
+		return (*it).second->ClassName();
+	}
+
+	template<typename AbstractProductT>
+	inline void Factory<AbstractProductT>::Recycle(gsl::owner<AbstractProductT*> product)
+	{
+		auto it = mTypeFactoryTable.Find(product->TypeIdInstance());
+		if (it == mTypeFactoryTable.end() || !(*it).second->IsPooled())
+		{
+			delete product;
+			return;
+		}
+
+		Factory& factory = *(*it).second;
+		try
+		{
+			factory.Reset(*product);
+		}
+		catch (...)
+		{
+			// the product was destroyed and its memory freed, there is nothing left to pool
+			return;
+		}
+
+		std::scoped_lock<std::mutex> lock(factory.mPoolMutex);
+		factory.mPool.PushBack(product);
+	}
+
+	template<typename AbstractProductT>
+	inline std::size_t Factory<AbstractProductT>::PoolSize() const
+	{
+		std::scoped_lock<std::mutex> lock(mPoolMutex);
+		return mPool.Size();
+	}
+
+	template<typename AbstractProductT>
+	inline gsl::owner<AbstractProductT*> Factory<AbstractProductT>::Acquire()
+	{
+		std::scoped_lock<std::mutex> lock(mPoolMutex);
+		if (mPool.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		AbstractProductT* product = mPool.Back();
+		mPool.PopBack();
+		return product;
+	}
+
 
 	template<typename AbstractProductT>
 	inline void Factory<AbstractProductT>::Add(Factory& concreteFactory)
 	{
 		mConcreteFactoryTable.Insert(std::make_pair( concreteFactory.ClassName(), &concreteFactory ));
+		mTypeFactoryTable.Insert(std::make_pair(concreteFactory.ProductTypeId(), &concreteFactory));
 	}
 
 	template<typename AbstractProductT>
 	inline void Factory<AbstractProductT>::Remove(Factory& concreteFactory)
 	{
 		mConcreteFactoryTable.Remove(concreteFactory.ClassName());
+
+		// products without RTTI of their own share the type id of their base, only the factory registered for it removes it
+		auto it = mTypeFactoryTable.Find(concreteFactory.ProductTypeId());
+		if (it != mTypeFactoryTable.end() && (*it).second == &concreteFactory)
+		{
+			mTypeFactoryTable.Remove(concreteFactory.ProductTypeId());
+		}
 	}
 
 
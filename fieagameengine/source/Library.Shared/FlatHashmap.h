@@ -0,0 +1,442 @@
+#pragma once
+#include "vector.h"
+
+#include "DefaultEquality.h"
+#include "DefaultHash.h"
+#include "FunctorPolicy.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Represents a Templated Hashmap using Open Addressing (Robin Hood linear probing).
+	/// The probe table is a flat Vector of Slots (cached hash, probe distance, entry pointer),
+	/// so a lookup walks contiguous memory and only touches an entry once the hashes match.
+	/// Entries are carved out of pooled blocks instead of one allocation per node,
+	/// and they never move once inserted, so pointers/references to a PairType stay valid
+	/// until that pair is removed (Scope keeps such pointers in its ordered vector).
+	/// Iterators are invalidated by Insert and Remove.
+	/// THash and TEquality are policies like Hashmap's, use RuntimeFlatHashmap to pick them at runtime.
+	/// </summary>
+	template <typename TKey, typename TData, typename THash = DefaultHash<TKey>, typename TEquality = DefaultEquality<TKey>>
+	class FlatHashmap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using HashFunctor = THash;
+		using EqualityFunctor = TEquality;
+
+	private:
+		/// <summary>
+		/// A probe table entry, Entry is nullptr when the slot is empty
+		/// Distance is how far the slot is from the one its hash maps to
+		/// </summary>
+		struct Slot final
+		{
+			std::size_t Hash{ 0 };
+			PairType* Entry{ nullptr };
+			std::size_t Distance{ 0 };
+		};
+
+		/// <summary>
+		/// Raw storage for a single pooled entry, doubles as a free list link when unused
+		/// </summary>
+		union EntryStorage
+		{
+			EntryStorage* NextFree;
+			alignas(PairType) unsigned char Bytes[sizeof(PairType)];
+		};
+
+		struct EntryBlock final
+		{
+			EntryStorage* Entries{ nullptr };
+			std::size_t Count{ 0 };
+		};
+
+	public:
+		/// <summary>
+		/// Embedded class for FlatHashmap to use to traverse its members.
+		/// It will include an index to represent the slot it is pointing at
+		/// </summary>
+		struct Iterator final
+		{
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = PairType;
+			using reference = PairType&;
+			using pointer = PairType*;
+			using iterator_category = std::forward_iterator_tag;
+
+			friend FlatHashmap;
+			friend struct ConstIterator;
+
+		public:
+			/// <summary>
+			/// Default Constructor
+			/// </summary>
+			Iterator() = default;
+			/// <summary>
+			/// Default Copy Constructor
+			/// </summary>
+			/// <param name="">Takes in a const Iterator&</param>
+			Iterator(const Iterator&) = default;
+			/// <summary>
+			/// Default Move Constructor
+			/// </summary>
+			/// <param name="">Takes in a Iterator&&</param>
+			/// <returns>Moved Iterator</returns>
+			Iterator(Iterator&&) noexcept = default;
+			/// <summary>
+			/// Default Copy Assignment
+			/// </summary>
+			/// <param name="">Takes in a const Iterator&</param>
+			/// <returns>Copied Iterator</returns>
+			Iterator& operator=(const Iterator&) = default;
+			/// <summary>
+			/// Default Move Assignment
+			/// </summary>
+			/// <param name="">Takes in a Iterator&&</param>
+			/// <returns>Moved Iterator</returns>
+			Iterator& operator=(Iterator&&) noexcept = default;
+			/// <summary>
+			/// Default Destructor
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Pre-Increment Operator
+			/// </summary>
+			/// <returns>Incremented Iterator</returns>
+			Iterator& operator ++ ();
+			/// <summary>
+			/// Post-Increment Operator
+			/// </summary>
+			/// <returns>Copy of Iterator before Increment</returns>
+			Iterator operator ++ (int);
+
+			/// <summary>
+			/// Equal Operator
+			/// </summary>
+			/// <param name="rhs">takes in a rhs</param>
+			/// <returns>bool</returns>
+			const bool operator == (const Iterator& rhs) const;
+			/// <summary>
+			/// Not Equal Operator
+			/// </summary>
+			/// <param name="rhs">takes in a rhs</param>
+			/// <returns>bool</returns>
+			const bool operator != (const Iterator& rhs) const;
+
+			/// <summary>
+			/// Dereference Operator
+			/// </summary>
+			/// <returns>Returns a reference to the item pointed by the Iterator</returns>
+			PairType& operator * () const;
+
+			/// <summary>
+			/// Pointer Dereference Operator
+			/// </summary>
+			/// <returns>Returns a Pointer reference to the item pointed by the Iterator</returns>
+			PairType* operator -> () const;
+
+		private:
+			/// <summary>
+			/// Iterator Constructor
+			/// </summary>
+			/// <param name="owner">member variable to keep track of FlatHashmap that owns this Iterator</param>
+			/// <param name="index">an Index of the slot that holds the entry</param>
+			Iterator(FlatHashmap* owner, size_t index);
+
+			FlatHashmap* mOwner{ nullptr };
+			size_t mIndex{ 0 };
+		};
+
+		/// <summary>
+		/// Embedded class for FlatHashmap to use to traverse its members.
+		/// It will include an index to represent the slot it is pointing at
+		/// </summary>
+		struct ConstIterator final
+		{
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = PairType;
+			using reference = PairType&;
+			using pointer = PairType*;
+			using iterator_category = std::forward_iterator_tag;
+
+			friend FlatHashmap;
+
+		public:
+			/// <summary>
+			/// Default Constructor
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// ConstIterator Constructor
+			/// </summary>
+			/// <param name="it">const Iterator reference</param>
+			ConstIterator(const Iterator& it);
+			/// <summary>
+			/// Default Copy Constructor
+			/// </summary>
+			/// <param name="">Takes in a const ConstIterator&</param>
+			ConstIterator(const ConstIterator&) = default;
+			/// <summary>
+			/// Default Move Constructor
+			/// </summary>
+			/// <param name="">Takes in a ConstIterator&&</param>
+			/// <returns>Moved ConstIterator</returns>
+			ConstIterator(ConstIterator&&) noexcept = default;
+			/// <summary>
+			/// Default Copy Assignment
+			/// </summary>
+			/// <param name="">Takes in a const ConstIterator&</param>
+			/// <returns>Copied ConstIterator</returns>
+			ConstIterator& operator=(const ConstIterator&) = default;
+			/// <summary>
+			/// Default Move Assignment
+			/// </summary>
+			/// <param name="">Takes in a ConstIterator&&</param>
+			/// <returns>Moved ConstIterator</returns>
+			ConstIterator& operator=(ConstIterator&&) noexcept = default;
+			/// <summary>
+			/// Default Destructor
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Pre-Increment Operator
+			/// </summary>
+			/// <returns>Incremented Iterator</returns>
+			ConstIterator& operator ++ ();
+			/// <summary>
+			/// Post-Increment Operator
+			/// </summary>
+			/// <returns>Copy of Iterator before Increment</returns>
+			ConstIterator operator ++ (int);
+
+			/// <summary>
+			/// Equal Operator
+			/// </summary>
+			/// <param name="rhs">takes in a rhs</param>
+			/// <returns>bool</returns>
+			const bool operator == (const ConstIterator& rhs) const;
+			/// <summary>
+			/// Not Equal Operator
+			/// </summary>
+			/// <param name="rhs">takes in a rhs</param>
+			/// <returns>bool</returns>
+			const bool operator != (const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// Dereference Operator
+			/// </summary>
+			/// <returns>Returns a const reference to the item pointed by the ConstIterator</returns>
+			const PairType& operator * () const;
+
+			/// <summary>
+			/// Pointer Dereference Operator
+			/// </summary>
+			/// <returns>Returns a const Pointer reference to the item pointed by the ConstIterator</returns>
+			const PairType* operator -> () const;
+
+		private:
+			/// <summary>
+			/// ConstIterator Constructor
+			/// </summary>
+			/// <param name="owner">member variable to keep track of FlatHashmap that owns this Iterator</param>
+			/// <param name="index">an Index of the slot that holds the entry</param>
+			ConstIterator(const FlatHashmap* owner, size_t index);
+
+			const FlatHashmap* mOwner{ nullptr };
+			size_t mIndex{ 0 };
+		};
+
+	public:
+		/// <summary>
+		/// Default Constructor
+		/// </summary>
+		/// <param name="capacity">number of slots, rounded up to a power of two</param>
+		/// <param name="hashFunctor">if none is provided, a Default one given</param>
+		/// <param name="equalityFunctor">if none is provided, a Default one given</param>
+		explicit FlatHashmap(size_t capacity = 32, HashFunctor hashFunctor = DefaultFunctor<HashFunctor, DefaultHash<TKey>>(), EqualityFunctor equalityFunctor = DefaultFunctor<EqualityFunctor, DefaultEquality<TKey>>());
+		/// <summary>
+		/// Copy Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a const FlatHashmap reference</param>
+		FlatHashmap(const FlatHashmap& rhs);
+		/// <summary>
+		/// Move Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a FlatHashmap&&</param>
+		/// <returns>Moved FlatHashmap</returns>
+		FlatHashmap(FlatHashmap&& rhs) noexcept;
+		/// <summary>
+		/// Copy Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a const FlatHashmap reference</param>
+		/// <returns>Copied FlatHashmap</returns>
+		FlatHashmap& operator=(const FlatHashmap& rhs);
+		/// <summary>
+		/// Move Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a FlatHashmap&&</param>
+		/// <returns>Moved FlatHashmap</returns>
+		FlatHashmap& operator=(FlatHashmap&& rhs) noexcept;
+		/// <summary>
+		/// Destructor
+		/// </summary>
+		~FlatHashmap();
+		/// <summary>
+		/// Inserts a list of PairType values into the FlatHashmap
+		/// </summary>
+		/// <param name="list">list of PairType to insert</param>
+		FlatHashmap(std::initializer_list<PairType> list, HashFunctor hashFunctor = DefaultFunctor<HashFunctor, DefaultHash<TKey>>(), EqualityFunctor equalityFunctor = DefaultFunctor<EqualityFunctor, DefaultEquality<TKey>>());
+
+		/// <summary>
+		/// Takes an entry argument (constant reference to PairType) and which returns an Iterator.
+		/// If the table already contains an entry with a key that matches the key of the given entry,
+		/// then do not modify the entry. Simply return the iterator of the found key.
+		/// </summary>
+		/// <param name="pair">Takes a constant reference to PairType</param>
+		/// <returns>returns a pair including Iterator and a bool (true if a new element is inserted and false if returning an existing iterator)</returns>
+		std::tuple<Iterator, bool> Insert(const PairType& pair);
+
+		std::tuple<Iterator, bool> Insert(PairType&& pair);
+
+		/// <summary>
+		/// Takes a key argument (constant reference to TKey) and which returns an Iterator.
+		/// </summary>
+		/// <param name="key">constant reference to TKey</param>
+		/// <returns>returns an Iterator</returns>
+		Iterator Find(const TKey& key);
+		/// <summary>
+		/// Takes a key argument (constant reference to TKey) and which returns an ConstIterator.
+		/// </summary>
+		/// <param name="key">constant reference to TKey</param>
+		/// <returns>returns an ConstIterator</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Removes the matching entry, if it exists, otherwise it does nothing.
+		/// Entries after it in the probe sequence are shifted back (no tombstones are left behind).
+		/// </summary>
+		/// <param name="key">constant reference to TKey</param>
+		void Remove(const TKey& key);
+		/// <summary>
+		/// Removes the entry the Iterator is pointing at, if it is not end()
+		/// </summary>
+		/// <param name="it">Iterator</param>
+		void Remove(const Iterator& it);
+
+		/// <summary>
+		/// Clears all the inserted elements, the slots and pooled entry memory are preserved
+		/// </summary>
+		void Clear();
+
+		TData& operator [] (const TKey& key);
+		const TData& operator [] (const TKey& key) const;
+
+		TData& At(const TKey& key);
+		const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// Gets the number of elements inserted in the hashmap
+		/// </summary>
+		/// <returns>const size_t of number of elements</returns>
+		const size_t Size() const;
+		/// <summary>
+		/// Gets the Number of Slots in the FlatHashmap
+		/// </summary>
+		/// <returns>const size_t of number of slots</returns>
+		const size_t BucketSize() const;
+
+		/// <summary>
+		/// returns a Boolean indicating the presence of a key within the hash map.
+		/// </summary>
+		/// <param name="key">key to check if in hashmap</param>
+		/// <returns>Boolean</returns>
+		const bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Returns an FlatHashmap::Iterator pointing to the first occupied slot
+		/// </summary>
+		/// <returns>Returns an FlatHashmap::Iterator pointing to the first occupied slot</returns>
+		Iterator begin();
+		/// <summary>
+		/// Returns an FlatHashmap::ConstIterator pointing to the first occupied slot
+		/// </summary>
+		/// <returns>Returns an FlatHashmap::ConstIterator pointing to the first occupied slot</returns>
+		ConstIterator begin() const;
+		/// <summary>
+		/// Returns an FlatHashmap::ConstIterator pointing to the first occupied slot
+		/// </summary>
+		/// <returns>Returns an FlatHashmap::ConstIterator pointing to the first occupied slot</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Returns an FlatHashmap::Iterator pointing one past the last slot.
+		/// </summary>
+		/// <returns>Returns an FlatHashmap::Iterator pointing one past the last slot.</returns>
+		Iterator end();
+		/// <summary>
+		/// Returns an FlatHashmap::ConstIterator pointing one past the last slot.
+		/// </summary>
+		/// <returns>Returns an FlatHashmap::ConstIterator pointing one past the last slot.</returns>
+		ConstIterator end() const;
+		/// <summary>
+		/// Returns an FlatHashmap::ConstIterator pointing one past the last slot.
+		/// </summary>
+		/// <returns>Returns an FlatHashmap::ConstIterator pointing one past the last slot.</returns>
+		ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Returns the slot index holding key, or the slot count if it is not in the table
+		/// </summary>
+		size_t FindIndex(const TKey& key, size_t hash) const;
+		/// <summary>
+		/// Places an entry that is known not to be in the table, returns the slot it landed in
+		/// </summary>
+		size_t Place(size_t hash, PairType* entry);
+		/// <summary>
+		/// Grows the probe table if one more entry would go over the max load factor
+		/// </summary>
+		void GrowIfNeeded();
+		/// <summary>
+		/// Rebuilds the probe table with the given number of slots, entries are not moved
+		/// </summary>
+		void RebuildSlots(size_t slotCount);
+		/// <summary>
+		/// Takes an entry from the pool, allocating a new block when the free list is empty
+		/// </summary>
+		EntryStorage* AllocateEntry();
+		/// <summary>
+		/// Destructs the pair and returns its storage to the pool
+		/// </summary>
+		void ReleaseEntry(PairType* entry);
+		/// <summary>
+		/// Frees every pooled block, entries must already be destructed
+		/// </summary>
+		void FreeBlocks();
+
+		const size_t NextOccupied(size_t index) const;
+
+		inline static const size_t MinimumSlotCount = 8;
+		inline static const size_t MinimumBlockCount = 8;
+
+		Vector<Slot> mSlots;
+		Vector<EntryBlock> mBlocks;
+		EntryStorage* mFreeList{ nullptr };
+		size_t mSize{ 0 };
+		HashFunctor mHashFunctor;
+		EqualityFunctor mEqualityFunctor;
+	};
+
+	/// <summary>
+	/// FlatHashmap whose hash and equality are std::functions, for callers that configure them at runtime
+	/// </summary>
+	template <typename TKey, typename TData>
+	using RuntimeFlatHashmap = FlatHashmap<TKey, TData, HashFunction<TKey>, EqualityFunction<TKey>>;
+}
+
+#include "FlatHashmap.inl"
@@ -0,0 +1,626 @@
+#include "FlatHashmap.h"
+
+namespace Library
+{
+#pragma region Iterator
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::Iterator::Iterator(FlatHashmap* owner, size_t index) :
+		mOwner(owner), mIndex(index)
+	{
+	}
+
+	// pre-increment
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator& FlatHashmap<TKey, TData, THash, TEquality>::Iterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Owner pointing to nullptr");
+		}
+
+		if (mIndex >= mOwner->BucketSize() || mOwner->Size() == 0)
+		{
+			throw std::runtime_error("Incrementing Iterator to out of bounds");
+		}
+
+		mIndex = mOwner->NextOccupied(mIndex + 1);
+		return *this;
+	}
+
+	// post-increment
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator FlatHashmap<TKey, TData, THash, TEquality>::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		operator++();
+
+		return temp;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool FlatHashmap<TKey, TData, THash, TEquality>::Iterator::operator==(const Iterator& rhs) const
+	{
+		return (mOwner == rhs.mOwner) && (mIndex == rhs.mIndex);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool FlatHashmap<TKey, TData, THash, TEquality>::Iterator::operator!=(const Iterator& rhs) const
+	{
+		return !(operator==(rhs));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::PairType& FlatHashmap<TKey, TData, THash, TEquality>::Iterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Owner is nullptr.");
+		}
+
+		if (mIndex >= mOwner->BucketSize() || mOwner->mSlots[mIndex].Entry == nullptr)
+		{
+			throw std::runtime_error("Iterator is trying to dereference out of bounds.");
+		}
+
+		return *(mOwner->mSlots[mIndex].Entry);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::PairType* FlatHashmap<TKey, TData, THash, TEquality>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::ConstIterator(const Iterator& it) :
+		mOwner(it.mOwner), mIndex(it.mIndex)
+	{
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::ConstIterator(const FlatHashmap* owner, size_t index) :
+		mOwner(owner), mIndex(index)
+	{
+	}
+
+	// pre-increment
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator& FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Owner pointing to nullptr");
+		}
+
+		if (mIndex >= mOwner->BucketSize() || mOwner->Size() == 0)
+		{
+			throw std::runtime_error("Incrementing Iterator to out of bounds");
+		}
+
+		mIndex = mOwner->NextOccupied(mIndex + 1);
+		return *this;
+	}
+
+	// post-increment
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp = *this;
+		operator++();
+
+		return temp;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::operator==(const ConstIterator& rhs) const
+	{
+		return (mOwner == rhs.mOwner) && (mIndex == rhs.mIndex);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	{
+		return !(operator==(rhs));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const typename FlatHashmap<TKey, TData, THash, TEquality>::PairType& FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Owner is nullptr.");
+		}
+
+		if (mIndex >= mOwner->BucketSize() || mOwner->mSlots[mIndex].Entry == nullptr)
+		{
+			throw std::runtime_error("Iterator is trying to dereference out of bounds.");
+		}
+
+		return *(mOwner->mSlots[mIndex].Entry);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const typename FlatHashmap<TKey, TData, THash, TEquality>::PairType* FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+#pragma endregion ConstIterator
+
+#pragma region FlatHashmap
+
+#pragma region Constructors, Destructor & Assignments
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::FlatHashmap(size_t capacity, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
+		mHashFunctor(hashFunctor), mEqualityFunctor(equalityFunctor)
+	{
+		size_t slotCount = MinimumSlotCount;
+		while (slotCount < capacity)
+		{
+			slotCount <<= 1;
+		}
+
+		mSlots.Resize(slotCount);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::FlatHashmap(const FlatHashmap& rhs) :
+		mSize(rhs.mSize), mHashFunctor(rhs.mHashFunctor), mEqualityFunctor(rhs.mEqualityFunctor)
+	{
+		// keep the exact slot layout of rhs, only the entries are cloned
+		mSlots.Resize(rhs.mSlots.Size());
+		for (size_t i = 0; i < rhs.mSlots.Size(); ++i)
+		{
+			const Slot& slot = rhs.mSlots[i];
+			if (slot.Entry != nullptr)
+			{
+				PairType* entry = new (AllocateEntry()->Bytes) PairType(*slot.Entry);
+				mSlots[i] = { slot.Hash, entry, slot.Distance };
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::FlatHashmap(FlatHashmap&& rhs) noexcept :
+		mSlots(std::move(rhs.mSlots)), mBlocks(std::move(rhs.mBlocks)), mFreeList(rhs.mFreeList), mSize(rhs.mSize),
+		mHashFunctor(rhs.mHashFunctor), mEqualityFunctor(rhs.mEqualityFunctor)
+	{
+		rhs.mFreeList = nullptr;
+		rhs.mSize = 0;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>& FlatHashmap<TKey, TData, THash, TEquality>::operator=(const FlatHashmap& rhs)
+	{
+		if (this != &rhs)
+		{
+			FlatHashmap copy(rhs);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>& FlatHashmap<TKey, TData, THash, TEquality>::operator=(FlatHashmap&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			FreeBlocks();
+
+			mSlots = std::move(rhs.mSlots);
+			mBlocks = std::move(rhs.mBlocks);
+			mFreeList = rhs.mFreeList;
+			mSize = rhs.mSize;
+			mHashFunctor = rhs.mHashFunctor;
+			mEqualityFunctor = rhs.mEqualityFunctor;
+
+			rhs.mFreeList = nullptr;
+			rhs.mSize = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::~FlatHashmap()
+	{
+		Clear();
+		FreeBlocks();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline FlatHashmap<TKey, TData, THash, TEquality>::FlatHashmap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
+		FlatHashmap(list.size() + list.size() / 2, hashFunctor, equalityFunctor)
+	{
+		for (auto& pair : list)
+		{
+			Insert(pair);
+		}
+	}
+
+#pragma endregion Constructors, Destructor & Assignments
+
+#pragma region Functions
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline std::tuple<typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator, bool> FlatHashmap<TKey, TData, THash, TEquality>::Insert(const PairType& pair)
+	{
+		size_t hash = mHashFunctor(pair.first);
+		size_t index = FindIndex(pair.first, hash);
+
+		if (index != mSlots.Size())
+		{
+			return std::tuple<Iterator, bool>(Iterator(this, index), false);
+		}
+
+		GrowIfNeeded();
+
+		PairType* entry = new (AllocateEntry()->Bytes) PairType(pair);
+		++mSize;
+
+		return std::tuple<Iterator, bool>(Iterator(this, Place(hash, entry)), true);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline std::tuple<typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator, bool> FlatHashmap<TKey, TData, THash, TEquality>::Insert(PairType&& pair)
+	{
+		size_t hash = mHashFunctor(pair.first);
+		size_t index = FindIndex(pair.first, hash);
+
+		if (index != mSlots.Size())
+		{
+			return std::tuple<Iterator, bool>(Iterator(this, index), false);
+		}
+
+		GrowIfNeeded();
+
+		PairType* entry = new (AllocateEntry()->Bytes) PairType(std::move(pair));
+		++mSize;
+
+		return std::tuple<Iterator, bool>(Iterator(this, Place(hash, entry)), true);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator FlatHashmap<TKey, TData, THash, TEquality>::Find(const TKey& key)
+	{
+		return Iterator(this, FindIndex(key, mHashFunctor(key)));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator FlatHashmap<TKey, TData, THash, TEquality>::Find(const TKey& key) const
+	{
+		return ConstIterator(this, FindIndex(key, mHashFunctor(key)));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::Remove(const TKey& key)
+	{
+		Remove(Find(key));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::Remove(const Iterator& it)
+	{
+		if (it.mOwner != this)
+		{
+			throw std::runtime_error("Mismatch Owner: Invalid Iterator");
+		}
+
+		if (it == end())
+		{
+			return;
+		}
+
+		ReleaseEntry(mSlots[it.mIndex].Entry);
+		--mSize;
+
+		// backward shift deletion: pull the rest of the probe run one slot closer to home
+		const size_t mask = mSlots.Size() - 1;
+		size_t index = it.mIndex;
+		size_t next = (index + 1) & mask;
+		while (mSlots[next].Entry != nullptr && mSlots[next].Distance > 0)
+		{
+			mSlots[index] = mSlots[next];
+			--mSlots[index].Distance;
+
+			index = next;
+			next = (next + 1) & mask;
+		}
+
+		mSlots[index] = Slot();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool FlatHashmap<TKey, TData, THash, TEquality>::ContainsKey(const TKey& key) const
+	{
+		return FindIndex(key, mHashFunctor(key)) != mSlots.Size();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::Clear()
+	{
+		if (mSize == 0)
+		{
+			return;
+		}
+
+		for (Slot& slot : mSlots)
+		{
+			if (slot.Entry != nullptr)
+			{
+				ReleaseEntry(slot.Entry);
+				slot = Slot();
+			}
+		}
+
+		mSize = 0;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline TData& FlatHashmap<TKey, TData, THash, TEquality>::operator[](const TKey& key)
+	{
+		size_t hash = mHashFunctor(key);
+		size_t index = FindIndex(key, hash);
+
+		if (index == mSlots.Size())
+		{
+			GrowIfNeeded();
+
+			PairType* entry = new (AllocateEntry()->Bytes) PairType(key, TData());
+			++mSize;
+			index = Place(hash, entry);
+		}
+
+		return mSlots[index].Entry->second;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const TData& FlatHashmap<TKey, TData, THash, TEquality>::operator[](const TKey& key) const
+	{
+		return this->At(key);
+	}
+
+#pragma endregion Functions
+
+#pragma region Member Accessors
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline TData& FlatHashmap<TKey, TData, THash, TEquality>::At(const TKey& key)
+	{
+		size_t index = FindIndex(key, mHashFunctor(key));
+
+		if (index == mSlots.Size())
+		{
+			throw std::runtime_error("Invalid Key: Key not found");
+		}
+
+		return mSlots[index].Entry->second;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const TData& FlatHashmap<TKey, TData, THash, TEquality>::At(const TKey& key) const
+	{
+		size_t index = FindIndex(key, mHashFunctor(key));
+
+		if (index == mSlots.Size())
+		{
+			throw std::runtime_error("Invalid Key: Key not found");
+		}
+
+		return mSlots[index].Entry->second;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const size_t FlatHashmap<TKey, TData, THash, TEquality>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const size_t FlatHashmap<TKey, TData, THash, TEquality>::BucketSize() const
+	{
+		return mSlots.Size();
+	}
+
+#pragma endregion Member Accessors
+
+#pragma region Iterator Accessors
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator FlatHashmap<TKey, TData, THash, TEquality>::begin()
+	{
+		return Iterator(this, NextOccupied(0));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator FlatHashmap<TKey, TData, THash, TEquality>::begin() const
+	{
+		return ConstIterator(this, NextOccupied(0));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator FlatHashmap<TKey, TData, THash, TEquality>::cbegin() const
+	{
+		return this->begin();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::Iterator FlatHashmap<TKey, TData, THash, TEquality>::end()
+	{
+		return Iterator(this, mSlots.Size());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator FlatHashmap<TKey, TData, THash, TEquality>::end() const
+	{
+		return ConstIterator(this, mSlots.Size());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::ConstIterator FlatHashmap<TKey, TData, THash, TEquality>::cend() const
+	{
+		return this->end();
+	}
+
+#pragma endregion Iterator Accessors
+
+#pragma region Helpers
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline size_t FlatHashmap<TKey, TData, THash, TEquality>::FindIndex(const TKey& key, size_t hash) const
+	{
+		const size_t slotCount = mSlots.Size();
+		if (mSize == 0)
+		{
+			return slotCount;
+		}
+
+		const size_t mask = slotCount - 1;
+		size_t index = hash & mask;
+
+		// a Robin Hood run is ordered by distance, so once we pass a slot closer to its
+		// home than we are to ours the key cannot be further along
+		for (size_t distance = 0; ; ++distance)
+		{
+			const Slot& slot = mSlots[index];
+			if (slot.Entry == nullptr || slot.Distance < distance)
+			{
+				return slotCount;
+			}
+
+			if (slot.Hash == hash && mEqualityFunctor(slot.Entry->first, key))
+			{
+				return index;
+			}
+
+			index = (index + 1) & mask;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline size_t FlatHashmap<TKey, TData, THash, TEquality>::Place(size_t hash, PairType* entry)
+	{
+		const size_t mask = mSlots.Size() - 1;
+		size_t index = hash & mask;
+		size_t placedAt = mSlots.Size();
+
+		Slot incoming{ hash, entry, 0 };
+		while (true)
+		{
+			Slot& slot = mSlots[index];
+			if (slot.Entry == nullptr)
+			{
+				slot = incoming;
+				return (placedAt == mSlots.Size() ? index : placedAt);
+			}
+
+			// steal from the rich: the entry closer to home gets pushed further along
+			if (slot.Distance < incoming.Distance)
+			{
+				std::swap(slot, incoming);
+				if (placedAt == mSlots.Size())
+				{
+					placedAt = index;
+				}
+			}
+
+			index = (index + 1) & mask;
+			++incoming.Distance;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::GrowIfNeeded()
+	{
+		// max load factor of 7/8
+		const size_t slotCount = mSlots.Size();
+		if (slotCount == 0 || (mSize + 1) > (slotCount - slotCount / 8))
+		{
+			RebuildSlots(slotCount < MinimumSlotCount ? MinimumSlotCount : slotCount * 2);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::RebuildSlots(size_t slotCount)
+	{
+		Vector<Slot> oldSlots(std::move(mSlots));
+
+		mSlots = Vector<Slot>();
+		mSlots.Resize(slotCount);
+
+		for (const Slot& slot : oldSlots)
+		{
+			if (slot.Entry != nullptr)
+			{
+				Place(slot.Hash, slot.Entry);
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename FlatHashmap<TKey, TData, THash, TEquality>::EntryStorage* FlatHashmap<TKey, TData, THash, TEquality>::AllocateEntry()
+	{
+		if (mFreeList == nullptr)
+		{
+			// blocks grow with the table so the number of allocations stays logarithmic
+			size_t count = (mSize > MinimumBlockCount ? mSize : MinimumBlockCount);
+			EntryStorage* entries = static_cast<EntryStorage*>(Memory::Allocate(count * sizeof(EntryStorage)));
+			mBlocks.PushBack({ entries, count });
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				entries[i].NextFree = (i + 1 < count ? &entries[i + 1] : nullptr);
+			}
+			mFreeList = entries;
+		}
+
+		EntryStorage* storage = mFreeList;
+		mFreeList = storage->NextFree;
+		return storage;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::ReleaseEntry(PairType* entry)
+	{
+		entry->~PairType();
+
+		EntryStorage* storage = reinterpret_cast<EntryStorage*>(entry);
+		storage->NextFree = mFreeList;
+		mFreeList = storage;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void FlatHashmap<TKey, TData, THash, TEquality>::FreeBlocks()
+	{
+		for (EntryBlock& block : mBlocks)
+		{
+			Memory::Free(block.Entries);
+		}
+
+		mBlocks.Clear();
+		mFreeList = nullptr;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const size_t FlatHashmap<TKey, TData, THash, TEquality>::NextOccupied(size_t index) const
+	{
+		while (index < mSlots.Size() && mSlots[index].Entry == nullptr)
+		{
+			++index;
+		}
+
+		return index;
+	}
+
+#pragma endregion Helpers
+
+#pragma endregion FlatHashmap
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace Library
+{
+	/// <summary>
+	/// Type-erased growth functor, for containers whose growth strategy is picked at runtime
+	/// </summary>
+	using IncrementFunction = std::function<std::size_t(const std::size_t, const std::size_t)>;
+
+	/// <summary>
+	/// Type-erased hash functor, for containers whose hash is picked at runtime
+	/// </summary>
+	template <typename TKey>
+	using HashFunction = std::function<std::size_t(const TKey&)>;
+
+	/// <summary>
+	/// Type-erased equality functor, for containers whose key comparison is picked at runtime
+	/// </summary>
+	template <typename TKey>
+	using EqualityFunction = std::function<bool(const TKey&, const TKey&)>;
+
+	/// <summary>
+	/// Default value for a container's functor policy.
+	/// Policies built from the library default (the default itself, or a std::function alias) start out as the library default,
+	/// any other policy is default constructed. Keeps a type-erased policy from starting out empty.
+	/// </summary>
+	/// <returns>TFunctor</returns>
+	template <typename TFunctor, typename TDefault>
+	TFunctor DefaultFunctor();
+}
+
+#include "FunctorPolicy.inl"
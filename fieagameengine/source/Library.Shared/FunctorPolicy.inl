@@ -0,0 +1,17 @@
+#include "FunctorPolicy.h"
+
+namespace Library
+{
+	template <typename TFunctor, typename TDefault>
+	inline TFunctor DefaultFunctor()
+	{
+		if constexpr (std::is_constructible_v<TFunctor, TDefault>)
+		{
+			return TFunctor(TDefault());
+		}
+		else
+		{
+			return TFunctor();
+		}
+	}
+}
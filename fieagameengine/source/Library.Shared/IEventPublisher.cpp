@@ -1,35 +1,279 @@
 #include "pch.h"
 #include "IEventPublisher.h"
-#include <future>
+#include "JobSystem.h"
+#include <cassert>
+#include <thread>
 
 namespace Library
 {
+	namespace
+	{
+		/// <summary>
+		/// Delivery running on this thread, linked to the one it is nested in (a Notify that delivers another event)
+		/// </summary>
+		struct Delivery final
+		{
+			const void* List{ nullptr };
+			const Delivery* Outer{ nullptr };
+		};
+
+		thread_local const Delivery* sDelivery{ nullptr };
+
+		/// <summary>
+		/// Marks the current thread as running a delivery of a subscriber list for its lifetime
+		/// </summary>
+		class DeliveryScope final
+		{
+		public:
+			explicit DeliveryScope(const void* list) :
+				mDelivery{ list, sDelivery }
+			{
+				sDelivery = &mDelivery;
+			}
+			DeliveryScope(const DeliveryScope&) = delete;
+			DeliveryScope(DeliveryScope&&) = delete;
+			DeliveryScope& operator=(const DeliveryScope&) = delete;
+			DeliveryScope& operator=(DeliveryScope&&) = delete;
+			~DeliveryScope()
+			{
+				sDelivery = mDelivery.Outer;
+			}
+
+		private:
+			Delivery mDelivery;
+		};
+
+		/// <summary>
+		/// Holds a delivery's place in a reader count for its lifetime
+		/// </summary>
+		class ReaderScope final
+		{
+		public:
+			explicit ReaderScope(std::atomic<std::size_t>& readers) :
+				mReaders(readers)
+			{
+			}
+			ReaderScope(const ReaderScope&) = delete;
+			ReaderScope(ReaderScope&&) = delete;
+			ReaderScope& operator=(const ReaderScope&) = delete;
+			ReaderScope& operator=(ReaderScope&&) = delete;
+			~ReaderScope()
+			{
+				mReaders.fetch_sub(1);
+			}
+
+		private:
+			std::atomic<std::size_t>& mReaders;
+		};
+
+		bool IsDelivering(const void* list)
+		{
+			for (const Delivery* delivery = sDelivery; delivery != nullptr; delivery = delivery->Outer)
+			{
+				if (delivery->List == list)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+
 	RTTI_DEFINITIONS(IEventPublisher)
 
-	IEventPublisher::IEventPublisher(Vector<IEventSubscriber*>& subscribers, std::mutex& mutex) :
-		mSubscribersList(&subscribers), mMutex(&mutex)
+	IEventPublisher::IEventPublisher(SubscriberList& subscribers) :
+		mSubscribersList(&subscribers)
 	{
 	}
 	
-	void IEventPublisher::Deliver() const
+	void IEventPublisher::Deliver(JobSystem* jobSystem) const
+	{
+		const IEventPublisher* event = this;
+		DeliverBatch(&event, 1, jobSystem);
+	}
+
+	void IEventPublisher::DeliverBatch(const IEventPublisher* const* events, std::size_t count, JobSystem* jobSystem)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		// events of one type share a subscriber list, the first one stands for all of them
+		const IEventPublisher& first = *events[0];
+#if defined(DEBUG) || defined(_DEBUG)
+		for (std::size_t i = 1; i < count; ++i)
+		{
+			assert(events[i]->mSubscribersList == first.mSubscribersList);
+		}
+#endif
+		SubscriberList& list = *first.mSubscribersList;
+
+		// counted before the pendings are folded in, so an unsubscribe either makes it into this snapshot or waits for this delivery.
+		// Counted in the phase that is current once the count is in, a flip in between would not wait for it
+		std::size_t phase = list.Phase.load();
+		list.Readers[phase].fetch_add(1);
+		while (list.Phase.load() != phase)
+		{
+			list.Readers[phase].fetch_sub(1);
+			phase = list.Phase.load();
+			list.Readers[phase].fetch_add(1);
+		}
+		ReaderScope reading(list.Readers[phase]);
+		DeliveryScope delivering(&list);
+
+		first.UpdatePendings();
+
+		// the snapshot stays alive, and unchanged, for this delivery even if a new one gets published meanwhile
+		const std::shared_ptr<const Subscribers> subscribers = std::atomic_load(&list.Snapshot);
+		if (subscribers == nullptr)
+		{
+			return;
+		}
+
+		if (jobSystem == nullptr)
+		{
+			for (IEventSubscriber* subscriber : *subscribers)
+			{
+				subscriber->NotifyBatch(events, count);
+			}
+		}
+		else
+		{
+			jobSystem->ParallelFor(subscribers->Size(), [&list, &subscribers, events, count](std::size_t index, std::size_t)
+			{
+				DeliveryScope delivering(&list);
+				(*subscribers)[index]->NotifyBatch(events, count);
+			});
+		}
+	}
+
+	void IEventPublisher::UpdatePendings() const
 	{
-		std::vector<std::future<void>> futures;
+		SubscriberList& list = *mSubscribersList;
+		// sequentially consistent, pairing with the store in Unsubscribe and the reader count taken before this
+		if (!list.HasPendings.load())
 		{
-			std::scoped_lock<std::mutex> lock(*mMutex);
-						
-			for (auto& subscriber : *mSubscribersList)
+			return;
+		}
+
+		std::scoped_lock<std::mutex> lock(list.Mutex);
+		if (!list.HasPendings.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		const std::shared_ptr<const Subscribers> current = std::atomic_load(&list.Snapshot);
+		std::shared_ptr<Subscribers> next = (current != nullptr) ? std::make_shared<Subscribers>(*current) : std::make_shared<Subscribers>();
+
+		for (const SubscriberEntry& entry : list.Pendings)
+		{
+			if (!entry.IsUnsubscribed && next->Find(entry.EventSubscriberPtr) == next->end())
+			{
+				next->PushBack(entry.EventSubscriberPtr);
+			}
+		}
+		DeleteUnsubscribed(*next);
+
+		list.Pendings.Clear();
+		list.HasPendings.store(false, std::memory_order_relaxed);
+		std::atomic_store(&list.Snapshot, std::shared_ptr<const Subscribers>(std::move(next)));
+	}
+
+	void IEventPublisher::DeleteUnsubscribed(Subscribers& subscribers) const
+	{
+		for (const SubscriberEntry& entry : mSubscribersList->Pendings)
+		{
+			if (entry.IsUnsubscribed)
+			{
+				subscribers.Remove(entry.EventSubscriberPtr);
+			}
+		}
+	}
+
+	void IEventPublisher::Subscribe(SubscriberList& list, IEventSubscriber& subscriber)
+	{
+		std::scoped_lock<std::mutex> lock(list.Mutex);
+
+		// a later change to the same subscriber replaces the earlier one, so the last call wins
+		for (SubscriberEntry& entry : list.Pendings)
+		{
+			if (entry.EventSubscriberPtr == &subscriber)
+			{
+				entry.IsUnsubscribed = false;
+				return;
+			}
+		}
+
+		// nothing to do for a subscriber the snapshot already holds
+		const std::shared_ptr<const Subscribers> current = std::atomic_load(&list.Snapshot);
+		if (current != nullptr && current->Find(&subscriber) != current->end())
+		{
+			return;
+		}
+
+		list.Pendings.PushBack({ &subscriber, false });
+		list.HasPendings.store(true, std::memory_order_release);
+	}
+
+	void IEventPublisher::Unsubscribe(SubscriberList& list, IEventSubscriber& subscriber)
+	{
+		{
+			std::scoped_lock<std::mutex> lock(list.Mutex);
+
+			bool isPending = false;
+			for (SubscriberEntry& entry : list.Pendings)
 			{
-				futures.emplace_back(std::async(std::launch::async, [subscriber, this]()
+				if (entry.EventSubscriberPtr == &subscriber)
 				{
-					subscriber->Notify(*this);
-				}));
+					entry.IsUnsubscribed = true;
+					isPending = true;
+					break;
+				}
+			}
+
+			// nothing to undo for a subscriber the snapshot does not hold
+			const std::shared_ptr<const Subscribers> current = std::atomic_load(&list.Snapshot);
+			if (!isPending && current != nullptr && current->Find(&subscriber) != current->end())
+			{
+				list.Pendings.PushBack({ &subscriber, true });
+				list.HasPendings.store(true);
 			}
 		}
 
-		for (auto& f : futures)
+		WaitForReaders(list);
+	}
+
+	void IEventPublisher::UnsubscribeAll(SubscriberList& list)
+	{
+		{
+			std::scoped_lock<std::mutex> lock(list.Mutex);
+
+			list.Pendings.Clear();
+			list.Pendings.ShrinkToFit();
+			list.HasPendings.store(false, std::memory_order_relaxed);
+			std::atomic_store(&list.Snapshot, std::shared_ptr<const Subscribers>());
+		}
+
+		WaitForReaders(list);
+	}
+
+	void IEventPublisher::WaitForReaders(SubscriberList& list)
+	{
+		// a Notify waiting for its own delivery would never return
+		if (IsDelivering(&list))
+		{
+			return;
+		}
+
+		// deliveries starting from here on count in the other phase, only the ones already counted are waited for
+		std::scoped_lock<std::mutex> lock(list.GraceMutex);
+		const std::size_t phase = list.Phase.load();
+		list.Phase.store(phase ^ 1);
+		while (list.Readers[phase].load() != 0)
 		{
-			f.get();
+			std::this_thread::yield();
 		}
 	}
-	
-}
\ No newline at end of file
+}
@@ -2,10 +2,14 @@
 #include "RTTI.h"
 #include "Vector.h"
 #include "IEventSubscriber.h"
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 namespace Library
 {
+	class JobSystem;
+
 	/// <summary>
 	/// Abstract Base class for EventPublisher
 	/// </summary>
@@ -19,22 +23,71 @@ namespace Library
 		virtual ~IEventPublisher() = default;
 
 		/// <summary>
-		/// Notify all subscribers of this event.
+		/// Notify all subscribers of this event. Reads the published snapshot of the subscriber list without locking,
+		/// after folding in whatever (un)subscribed since the last delivery, so subscribers may (un)subscribe in Notify.
+		/// </summary>
+		/// <param name="jobSystem">job system to notify the subscribers on, nullptr to notify them in order on this thread</param>
+		void Deliver(JobSystem* jobSystem = nullptr) const;
+		/// <summary>
+		/// Notify all subscribers of a batch of events of the same Event type, each subscriber once with all of them
+		/// through NotifyBatch instead of once per event. (Un)subscribes made meanwhile take effect on the next delivery.
+		/// </summary>
+		/// <param name="events">events of the same Event type</param>
+		/// <param name="count">number of events</param>
+		/// <param name="jobSystem">job system to notify the subscribers on, nullptr to notify them in order on this thread</param>
+		static void DeliverBatch(const IEventPublisher* const* events, std::size_t count, JobSystem* jobSystem = nullptr);
+		/// <summary>
+		/// Publishes a new snapshot holding the pending subscribes and without the pending unsubscribes.
+		/// Returns straight away when nothing is pending, otherwise serialized with Subscribe and Unsubscribe.
 		/// </summary>
-		void Deliver() const;
 		void UpdatePendings() const;
-		void DeleteUnsubscribed() const;
+
 	protected:
+		using Subscribers = Vector<IEventSubscriber*>;
+
 		struct SubscriberEntry
 		{
 			IEventSubscriber* EventSubscriberPtr{ nullptr };
 			bool IsUnsubscribed{ false };
 		};
 
+		/// <summary>
+		/// Subscribers of one event type: an immutable snapshot that deliveries share, swapped atomically (RCU style),
+		/// the changes recorded since it was published and the number of deliveries in progress, counted per phase
+		/// so that an unsubscribe only waits for the deliveries that started before it
+		/// </summary>
+		struct SubscriberList final
+		{
+			std::shared_ptr<const Subscribers> Snapshot;
+			std::atomic<bool> HasPendings{ false };
+			std::atomic<std::size_t> Phase{ 0 };
+			std::atomic<std::size_t> Readers[2]{};
+			std::mutex Mutex;
+			std::mutex GraceMutex;
+			Vector<SubscriberEntry> Pendings;
+		};
+
+		/// <summary>
+		/// Records a subscribe, taking effect on the next delivery. Does nothing for a subscriber that is already subscribed
+		/// </summary>
+		static void Subscribe(SubscriberList& list, IEventSubscriber& subscriber);
+		/// <summary>
+		/// Records an unsubscribe, taking effect on the next delivery, then waits for the deliveries in progress
+		/// (which may still hold the subscriber) to finish, so the subscriber can be destroyed once this returns.
+		/// Called from inside a Notify of this event type it does not wait: the subscriber has to outlive that delivery.
+		/// </summary>
+		static void Unsubscribe(SubscriberList& list, IEventSubscriber& subscriber);
+		/// <summary>
+		/// Drops every subscriber and pending change right away, releasing the memory,
+		/// then waits for the deliveries in progress the way Unsubscribe does
+		/// </summary>
+		static void UnsubscribeAll(SubscriberList& list);
+
 		/// <summary>
 		/// Default Constructor
 		/// </summary>
-		explicit IEventPublisher(Vector<IEventSubscriber*>& subscribers, std::mutex& mutex);
+		/// <param name="subscribers">subscriber list of the event type</param>
+		explicit IEventPublisher(SubscriberList& subscribers);
 		/// <summary>
 		/// Default Constructor
 		/// </summary>
@@ -65,7 +118,15 @@ namespace Library
 
 
 	private:
-		std::mutex* mMutex{ nullptr };
-		Vector<IEventSubscriber*>* mSubscribersList{ nullptr };
+		/// <summary>
+		/// Removes the subscribers with a pending unsubscribe from the snapshot being built
+		/// </summary>
+		void DeleteUnsubscribed(Subscribers& subscribers) const;
+		/// <summary>
+		/// (static) Waits until the deliveries of the list in progress have finished, unless this thread is running one
+		/// </summary>
+		static void WaitForReaders(SubscriberList& list);
+
+		SubscriberList* mSubscribersList{ nullptr };
 	};
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+
 namespace Library
 {
 	class IEventPublisher;
@@ -22,6 +24,20 @@ namespace Library
 		/// <param name="event">address of an EventPublisher</param>
 		virtual void Notify(const IEventPublisher& event) = 0;
 
+		/// <summary>
+		/// Accepts every event of one type that is delivered together, in expiry order.
+		/// Override to handle them in one go, by default each of them is handed to Notify.
+		/// </summary>
+		/// <param name="events">events of the same Event type</param>
+		/// <param name="count">number of events</param>
+		virtual void NotifyBatch(const IEventPublisher* const* events, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				Notify(*events[i]);
+			}
+		}
+
 	protected:
 		/// <summary>
 		/// Default Constructor
@@ -54,18 +54,18 @@ namespace Library
 
 		/// <summary>
 		/// Given a shared data reference, a string for the Json key, 
-		/// a reference to the Json::Value object, 
+		/// a reference to the JsonValue, 
 		/// and a bool indicating if the value is an array element, 
 		/// attempt to handle the key/value pair. 
 		/// If this routine does indeed handle the pair, 
 		/// return true, otherwise return false.
 		/// </summary>
 		/// <param name="sharedData">shared data reference</param>
-		/// <param name="jsonKey">a string for the Json key</param>
-		/// <param name="jsonObjectRef">a reference to the Json::Value object</param>
+		/// <param name="jsonKey">a view of the Json key, only good during the call</param>
+		/// <param name="jsonValueRef">a reference to the JsonValue, a view that is only good during the call</param>
 		/// <param name="isArrayElement">is an array element</param>
 		/// <returns>a bool</returns>
-		virtual bool StartHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey, const Json::Value& jsonValueRef, bool isArrayElement = false, std::size_t index = 0) = 0;
+		virtual bool StartHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey, const JsonValue& jsonValueRef, bool isArrayElement = false, std::size_t index = 0) = 0;
 		//Increment Depth of shared data
 
 		/// <summary>
@@ -77,7 +77,7 @@ namespace Library
 		/// <param name="sharedData">shared data reference</param>
 		/// <param name="jsonKey">string for the Json key</param>
 		/// <returns>a bool</returns>
-		virtual bool EndHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey) = 0;
+		virtual bool EndHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey) = 0;
 		//Decrement Depth of shared data
 
 		/// <summary>
@@ -0,0 +1,284 @@
+#include "pch.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cassert>
+
+namespace Library
+{
+	thread_local std::size_t JobSystem::sSlot{ JobSystem::NoSlot };
+
+#pragma region WaitGroup
+
+	JobSystem::WaitGroup::~WaitGroup()
+	{
+		assert(IsDone());
+	}
+
+	bool JobSystem::WaitGroup::IsDone() const
+	{
+		return mRemaining.load(std::memory_order_acquire) == 0;
+	}
+
+#pragma endregion WaitGroup
+
+#pragma region JobSystem
+
+	JobSystem::JobSystem(std::size_t workerCount)
+	{
+		// the last queue belongs to whichever outside thread is waiting
+		mQueues.Reserve(workerCount + 1);
+		for (std::size_t i = 0; i <= workerCount; ++i)
+		{
+			mQueues.PushBack(new Queue());
+		}
+
+		mWorkers.Reserve(workerCount);
+		for (std::size_t i = 0; i < workerCount; ++i)
+		{
+			mWorkers.PushBack(new std::thread(&JobSystem::WorkerLoop, this, i));
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(mWakeMutex);
+			mStopping = true;
+		}
+		mWake.notify_all();
+
+		for (std::thread* worker : mWorkers)
+		{
+			worker->join();
+			delete worker;
+		}
+
+		// without workers, whatever was submitted but never waited on runs here
+		while (TryRunChunk(SlotCount() - 1, nullptr))
+		{
+		}
+
+		for (Queue* queue : mQueues)
+		{
+			delete queue;
+		}
+	}
+
+	void JobSystem::Submit(WaitGroup& group, Job job)
+	{
+		Vector<Chunk> chunks;
+		chunks.Reserve(1);
+		chunks.PushBack({ &group, nullptr, 0, 0, std::move(job) });
+		Enqueue(chunks);
+	}
+
+	void JobSystem::Submit(WaitGroup& group, Vector<Job>& jobs)
+	{
+		Vector<Chunk> chunks;
+		chunks.Reserve(jobs.Size());
+		for (Job& job : jobs)
+		{
+			chunks.PushBack({ &group, nullptr, 0, 0, std::move(job) });
+		}
+		jobs.Clear();
+
+		Enqueue(chunks);
+	}
+
+	void JobSystem::Wait(WaitGroup& group)
+	{
+		// outside threads share one slot, so only one of them may work at a time
+		const bool isOutside = (sSlot == NoSlot);
+		std::unique_lock<std::mutex> dispatch(mDispatchMutex, std::defer_lock);
+		if (isOutside)
+		{
+			dispatch.lock();
+			sSlot = SlotCount() - 1;
+		}
+
+		// only the group's own chunks, anything else could hold this thread up far longer than the group needs
+		while (!group.IsDone())
+		{
+			if (!TryRunChunk(sSlot, &group))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (isOutside)
+		{
+			sSlot = NoSlot;
+		}
+
+		if (group.mError)
+		{
+			std::exception_ptr error = group.mError;
+			group.mError = nullptr;
+			std::rethrow_exception(error);
+		}
+	}
+
+	void JobSystem::ParallelFor(std::size_t count, const Body& body)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		WaitGroup group;
+
+		const std::size_t chunkCount = std::min(count, SlotCount() * ChunksPerSlot);
+		Vector<Chunk> chunks;
+		chunks.Reserve(chunkCount);
+		for (std::size_t i = 0; i < chunkCount; ++i)
+		{
+			chunks.PushBack({ &group, &body, count * i / chunkCount, count * (i + 1) / chunkCount, nullptr });
+		}
+
+		Enqueue(chunks);
+		Wait(group);
+	}
+
+	std::size_t JobSystem::WorkerCount() const
+	{
+		return mWorkers.Size();
+	}
+
+	std::size_t JobSystem::SlotCount() const
+	{
+		return mQueues.Size();
+	}
+
+	std::size_t JobSystem::DefaultWorkerCount()
+	{
+		const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	void JobSystem::Enqueue(Vector<Chunk>& chunks)
+	{
+		if (chunks.IsEmpty())
+		{
+			return;
+		}
+
+		for (Chunk& chunk : chunks)
+		{
+			chunk.Group->mRemaining.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// counted before the chunks are visible, so a worker never takes one the counter does not know about yet
+		{
+			std::scoped_lock<std::mutex> lock(mWakeMutex);
+			mPending += chunks.Size();
+		}
+
+		const std::size_t slotCount = SlotCount();
+		const std::size_t first = mNextQueue.fetch_add(chunks.Size(), std::memory_order_relaxed);
+		for (std::size_t offset = 0; offset < slotCount && offset < chunks.Size(); ++offset)
+		{
+			Queue& queue = *mQueues[(first + offset) % slotCount];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			for (std::size_t i = offset; i < chunks.Size(); i += slotCount)
+			{
+				queue.Chunks.push_back(std::move(chunks[i]));
+			}
+		}
+		mWake.notify_all();
+	}
+
+	void JobSystem::WorkerLoop(std::size_t slot)
+	{
+		sSlot = slot;
+
+		for (;;)
+		{
+			if (TryRunChunk(slot, nullptr))
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mWakeMutex);
+			mWake.wait(lock, [this] { return mStopping || mPending.load() > 0; });
+			if (mStopping && mPending.load() == 0)
+			{
+				break;
+			}
+		}
+	}
+
+	bool JobSystem::TryRunChunk(std::size_t slot, WaitGroup* group)
+	{
+		const std::size_t slotCount = SlotCount();
+		auto matches = [group](const Chunk& chunk) { return group == nullptr || chunk.Group == group; };
+
+		Chunk chunk;
+		bool found = false;
+
+		for (std::size_t i = 0; i < slotCount && !found; ++i)
+		{
+			Queue& queue = *mQueues[(slot + i) % slotCount];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+
+			// own work newest first while it is still warm, stolen work oldest first
+			if (i == 0)
+			{
+				auto it = std::find_if(queue.Chunks.rbegin(), queue.Chunks.rend(), matches);
+				if (it != queue.Chunks.rend())
+				{
+					chunk = std::move(*it);
+					queue.Chunks.erase(std::next(it).base());
+					found = true;
+				}
+			}
+			else
+			{
+				auto it = std::find_if(queue.Chunks.begin(), queue.Chunks.end(), matches);
+				if (it != queue.Chunks.end())
+				{
+					chunk = std::move(*it);
+					queue.Chunks.erase(it);
+					found = true;
+				}
+			}
+		}
+
+		if (!found)
+		{
+			return false;
+		}
+
+		--mPending;
+
+		WaitGroup& owner = *chunk.Group;
+		try
+		{
+			if (chunk.Work != nullptr)
+			{
+				for (std::size_t index = chunk.Begin; index < chunk.End; ++index)
+				{
+					(*chunk.Work)(index, slot);
+				}
+			}
+			else
+			{
+				chunk.Task(slot);
+			}
+		}
+		catch (...)
+		{
+			std::scoped_lock<std::mutex> lock(owner.mErrorMutex);
+			if (!owner.mError)
+			{
+				owner.mError = std::current_exception();
+			}
+		}
+
+		// the waiting thread may release the group, and whatever the job captured, as soon as this reaches zero
+		chunk.Task = nullptr;
+		owner.mRemaining.fetch_sub(1, std::memory_order_acq_rel);
+		return true;
+	}
+
+#pragma endregion JobSystem
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include "Vector.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace Library
+{
+	/// <summary>
+	/// Fixed set of worker threads, created once and reused, that run jobs and split ranges of indices into chunks.
+	/// Every worker, and the thread waiting from outside, owns a queue; a thread works through its own queue
+	/// newest first and steals the oldest chunk of another queue when its own runs dry.
+	/// Each thread is identified by a slot in [0, SlotCount()), so callers can keep one context per slot without locking.
+	/// </summary>
+	class JobSystem final
+	{
+	public:
+		/// <summary>
+		/// Single job, called with the slot of the thread running it
+		/// </summary>
+		using Job = std::function<void(std::size_t slot)>;
+		/// <summary>
+		/// Body of a ParallelFor, called once per index with the slot of the thread running it
+		/// </summary>
+		using Body = std::function<void(std::size_t index, std::size_t slot)>;
+
+		/// <summary>
+		/// Counts the outstanding jobs of one submission, or of several, so they can be joined together with Wait
+		/// </summary>
+		class WaitGroup final
+		{
+		public:
+			WaitGroup() = default;
+			WaitGroup(const WaitGroup&) = delete;
+			WaitGroup(WaitGroup&&) = delete;
+			WaitGroup& operator=(const WaitGroup&) = delete;
+			WaitGroup& operator=(WaitGroup&&) = delete;
+			/// <summary>
+			/// Destructor, the group has to be waited on before it goes away
+			/// </summary>
+			~WaitGroup();
+
+			/// <summary>
+			/// Returns true once every job submitted to the group has run
+			/// </summary>
+			/// <returns>bool</returns>
+			bool IsDone() const;
+
+		private:
+			friend class JobSystem;
+
+			std::atomic<std::size_t> mRemaining{ 0 };
+			std::mutex mErrorMutex;
+			std::exception_ptr mError;
+		};
+
+		inline static const std::size_t ChunksPerSlot = 4;
+
+		/// <summary>
+		/// Constructor, starts the worker threads
+		/// </summary>
+		/// <param name="workerCount">number of background threads, the waiting thread works as well</param>
+		explicit JobSystem(std::size_t workerCount = DefaultWorkerCount());
+		JobSystem(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem& operator=(JobSystem&&) = delete;
+		/// <summary>
+		/// Destructor, runs what is still queued and waits for the worker threads to finish
+		/// </summary>
+		~JobSystem();
+
+		/// <summary>
+		/// Queues one job in the group
+		/// </summary>
+		/// <param name="group">group to wait on</param>
+		/// <param name="job">job to run</param>
+		void Submit(WaitGroup& group, Job job);
+		/// <summary>
+		/// Queues a batch of jobs in the group, spread over all queues with one lock per queue and a single wake up
+		/// </summary>
+		/// <param name="group">group to wait on</param>
+		/// <param name="jobs">jobs to run, moved out and cleared</param>
+		void Submit(WaitGroup& group, Vector<Job>& jobs);
+		/// <summary>
+		/// Returns once every job of the group has run, helping with the group's own jobs meanwhile.
+		/// The first exception thrown by one of them is rethrown here.
+		/// Waiting from inside a job is fine; waits from threads outside the job system are serialized.
+		/// </summary>
+		/// <param name="group">group to join</param>
+		void Wait(WaitGroup& group);
+
+		/// <summary>
+		/// Runs body for every index in [0, count) and returns once all of them are done, see Wait.
+		/// A slot is only used by one thread at a time, but a body that waits itself can have other indices run on its slot meanwhile.
+		/// </summary>
+		/// <param name="count">number of indices</param>
+		/// <param name="body">work for one index</param>
+		void ParallelFor(std::size_t count, const Body& body);
+
+		/// <summary>
+		/// Gets the number of background threads
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t WorkerCount() const;
+		/// <summary>
+		/// Gets the number of slots handed to jobs, the workers plus the waiting thread
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t SlotCount() const;
+
+		/// <summary>
+		/// Gets one worker per hardware thread, leaving one for the waiting thread
+		/// </summary>
+		/// <returns>size_t</returns>
+		static std::size_t DefaultWorkerCount();
+
+	private:
+		struct Chunk final
+		{
+			WaitGroup* Group{ nullptr };
+			const Body* Work{ nullptr };
+			std::size_t Begin{ 0 };
+			std::size_t End{ 0 };
+			Job Task;
+		};
+
+		struct Queue final
+		{
+			std::mutex Mutex;
+			std::deque<Chunk> Chunks;
+		};
+
+		/// <summary>
+		/// Counts the chunks in their group and spreads them over the queues
+		/// </summary>
+		void Enqueue(Vector<Chunk>& chunks);
+		/// <summary>
+		/// Main loop of a worker thread
+		/// </summary>
+		void WorkerLoop(std::size_t slot);
+		/// <summary>
+		/// Runs one chunk, from the slot's own queue when it has one, stolen from another queue otherwise
+		/// </summary>
+		/// <param name="slot">slot of the calling thread</param>
+		/// <param name="group">only take chunks of this group, nullptr for any</param>
+		/// <returns>false if no chunk was found</returns>
+		bool TryRunChunk(std::size_t slot, WaitGroup* group);
+
+		inline static const std::size_t NoSlot = std::numeric_limits<std::size_t>::max();
+
+		Vector<Queue*> mQueues;
+		Vector<std::thread*> mWorkers;
+
+		std::mutex mDispatchMutex;
+		std::mutex mWakeMutex;
+		std::condition_variable mWake;
+		std::atomic<std::size_t> mPending{ 0 };
+		std::atomic<std::size_t> mNextQueue{ 0 };
+		bool mStopping{ false };
+
+		static thread_local std::size_t sSlot;
+	};
+}
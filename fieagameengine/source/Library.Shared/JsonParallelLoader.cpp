@@ -0,0 +1,184 @@
+#include "pch.h"
+#include "JsonParallelLoader.h"
+#include "JobSystem.h"
+#include "JsonParseMaster.h"
+#include "JsonTableParseHelper.h"
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// One file being loaded, its clone of the master and the scope the clone parses into
+		/// </summary>
+		struct Part final
+		{
+			gsl::owner<JsonParseMaster*> Master;
+			gsl::owner<Scope*> Root;
+		};
+
+		void Release(Vector<Part>& parts)
+		{
+			for (Part& part : parts)
+			{
+				delete part.Master;
+				delete part.Root;
+			}
+			parts.Clear();
+		}
+
+		template <typename T>
+		void CopyValues(const Datum& from, Datum& into)
+		{
+			// external storage has the size already, Check made sure it is the loaded one
+			if (into.IsExternal() == false)
+			{
+				into.Resize(from.Size());
+			}
+
+			for (std::size_t i = 0; i < from.Size(); ++i)
+			{
+				into.Set(from.Get<T>(i), i);
+			}
+		}
+	}
+
+	void JsonParallelLoader::LoadFiles(const JsonParseMaster& master, const Vector<std::string>& fileNames, Scope& target, JobSystem* jobSystem)
+	{
+		if (!master.GetSharedData()->Is<JsonTableParseHelper::SharedData>())
+		{
+			throw std::runtime_error("Loading files in parallel needs a JsonTableParseHelper::SharedData");
+		}
+
+		Vector<Part> parts;
+		parts.Reserve(fileNames.Size());
+
+		try
+		{
+			// cloned up front, the clone's SharedData comes with a fresh Scope that the part owns from here on
+			for (std::size_t i = 0; i < fileNames.Size(); ++i)
+			{
+				gsl::owner<JsonParseMaster*> clone = master.Clone();
+				parts.PushBack({ clone, clone->GetSharedData()->As<JsonTableParseHelper::SharedData>()->GetSharedData() });
+			}
+
+			auto parse = [&parts, &fileNames](std::size_t index, std::size_t)
+			{
+				parts[index].Master->ParseFromFile(fileNames[index]);
+			};
+
+			if (jobSystem != nullptr)
+			{
+				jobSystem->ParallelFor(parts.Size(), parse);
+			}
+			else
+			{
+				for (std::size_t i = 0; i < parts.Size(); ++i)
+				{
+					parse(i, 0);
+				}
+			}
+
+			// target is left as it was if any part does not fit it
+			Scope added;
+			for (const Part& part : parts)
+			{
+				Check(*part.Root, target, added);
+			}
+
+			for (Part& part : parts)
+			{
+				Merge(*part.Root, target);
+			}
+		}
+		catch (...)
+		{
+			Release(parts);
+			throw;
+		}
+
+		Release(parts);
+	}
+
+	void JsonParallelLoader::Check(const Scope& source, const Scope& target, Scope& added)
+	{
+		for (const Scope::HashTablePair* pair : source.GetOrderedVector())
+		{
+			const Symbol& key = pair->first;
+			const Datum& from = pair->second;
+
+			const Datum* into = target.Find(key);
+			if (into == nullptr || into->Type() == Datum::DatumTypes::Unknown)
+			{
+				into = added.Find(key);
+			}
+
+			if (into == nullptr)
+			{
+				added.Append(key).SetType(from.Type());
+				continue;
+			}
+
+			if (into->Type() != from.Type())
+			{
+				throw std::runtime_error("Loaded datum type does not match the target's");
+			}
+
+			if (from.Type() != Datum::DatumTypes::Table && into->IsExternal() && into->Size() != from.Size())
+			{
+				throw std::runtime_error("Loaded datum size does not match its external storage");
+			}
+		}
+	}
+
+	void JsonParallelLoader::Merge(Scope& source, Scope& target)
+	{
+		for (Scope::HashTablePair* pair : source.GetOrderedVector())
+		{
+			const Symbol& key = pair->first;
+			Datum& from = pair->second;
+
+			if (from.Type() == Datum::DatumTypes::Table)
+			{
+				// adopting takes the child out of from, so the children are gathered first
+				Vector<Scope*> children;
+				children.Reserve(from.Size());
+				for (std::size_t i = 0; i < from.Size(); ++i)
+				{
+					children.PushBack(&from[i]);
+				}
+
+				for (Scope* child : children)
+				{
+					target.Adopt(*child, key);
+				}
+				continue;
+			}
+
+			Datum& into = target.Append(key);
+			into.SetType(from.Type());
+
+			switch (from.Type())
+			{
+			case Datum::DatumTypes::Integer:
+				CopyValues<std::int32_t>(from, into);
+				break;
+			case Datum::DatumTypes::Float:
+				CopyValues<std::float_t>(from, into);
+				break;
+			case Datum::DatumTypes::Vector:
+				CopyValues<glm::vec4>(from, into);
+				break;
+			case Datum::DatumTypes::Matrix:
+				CopyValues<glm::mat4>(from, into);
+				break;
+			case Datum::DatumTypes::String:
+				CopyValues<std::string>(from, into);
+				break;
+			default:
+				// Json has no pointers, nothing else can come out of a file
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include "vector.h"
+#include "Scope.h"
+
+namespace Library
+{
+	class JobSystem;
+	class JsonParseMaster;
+
+	/// <summary>
+	/// Loads a scope that is split across many Json files, such as a World with one file per sector.
+	/// Every file is parsed on the job system by its own clone of a JsonParseMaster, into a Scope of its own,
+	/// and once all of them are parsed the results are merged into the target in the order the files are listed,
+	/// so the loaded tree does not depend on which file finished first.
+	/// </summary>
+	class JsonParallelLoader final
+	{
+	public:
+		JsonParallelLoader() = delete;
+
+		/// <summary>
+		/// (static) Parses the files and merges them into target. Nested scopes are adopted by target under the same key,
+		/// other values replace the values of target's datum of that key, so the last file listed wins.
+		/// Nothing is merged if any file fails to parse, or has a value whose type or size does not fit target's datum of that key.
+		/// The helpers, and the factories of the classes the files name, have to be safe to use on several threads at once:
+		/// types with pooled attributes (Signature::Pooled) share one pool per type, load those without a job system.
+		/// The parsed trees are built on the heap, the master's arena is not shared between threads
+		/// </summary>
+		/// <param name="master">master whose helpers are cloned, its SharedData has to be a JsonTableParseHelper::SharedData</param>
+		/// <param name="fileNames">files to load, merged in this order</param>
+		/// <param name="target">scope to merge into, usually a World</param>
+		/// <param name="jobSystem">job system to parse on, nullptr to parse the files one after another</param>
+		static void LoadFiles(const JsonParseMaster& master, const Vector<std::string>& fileNames, Scope& target, JobSystem* jobSystem = nullptr);
+
+	private:
+		/// <summary>
+		/// Throws if an attribute of a parsed file can't be merged into target
+		/// </summary>
+		/// <param name="source">root of a parsed file</param>
+		/// <param name="target">scope to merge into</param>
+		/// <param name="added">attributes the files checked before this one add to target, this one's are added to it</param>
+		static void Check(const Scope& source, const Scope& target, Scope& added);
+		/// <summary>
+		/// Moves the attributes of a parsed file into target, once every file has been checked
+		/// </summary>
+		static void Merge(Scope& source, Scope& target);
+	};
+}
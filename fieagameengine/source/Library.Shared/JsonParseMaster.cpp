@@ -1,7 +1,7 @@
 #include "pch.h"
 #include "JsonParseMaster.h"
 #include "IJsonParseHelper.h"
-#include <fstream>
+#include "MappedFile.h"
 
 namespace Library
 {
@@ -143,65 +143,84 @@ namespace Library
 		mListOfHelpers.Remove(&helper);
 	}
 
-	void JsonParseMaster::Parse(const std::string& jsonData)
+	void JsonParseMaster::Parse(std::string_view jsonData)
 	{
-		std::stringstream strStream;
-		strStream << jsonData;
-		Parse(strStream);
+		JsonTokenizer tokenizer(jsonData);
+		Parse(tokenizer);
 	}
 
 	void JsonParseMaster::Parse(std::istream& jsonInputStream)
 	{
-		Json::Value root;
-		jsonInputStream >> root;
+		JsonTokenizer tokenizer(jsonInputStream);
+		Parse(tokenizer);
+	}
+
+	void JsonParseMaster::Parse(JsonTokenizer& tokenizer)
+	{
+		if (tokenizer.Next() != JsonTokenizer::TokenType::BeginObject)
+		{
+			throw std::runtime_error("Json document must be an object");
+		}
 
 		mSharedData->IncrementDepth();
-		ParseMembers(root);
+		ParseMembers(tokenizer);
 		mSharedData->DecrementDepth();
+
+		if (tokenizer.Next() != JsonTokenizer::TokenType::End)
+		{
+			throw std::runtime_error("Unexpected data after the Json document");
+		}
 	}
 
-	void JsonParseMaster::Parse(const std::string& key, const Json::Value& jsonValue, bool isArrayElement, std::size_t index)
+	void JsonParseMaster::Parse(JsonTokenizer& tokenizer, JsonTokenizer::TokenType token, std::string_view key, bool isArrayElement, std::size_t index)
 	{
-		if (jsonValue.isObject())
+		if (token == JsonTokenizer::TokenType::BeginObject)
 		{
+			// members arrive after the handler is started, it only sees an empty object
 			mSharedData->IncrementDepth();
-			
+
+			bool handled = false;
 			for (IJsonParseHelper* helper : mListOfHelpers)
 			{
-				if (helper->StartHandler(*mSharedData, key, jsonValue, isArrayElement, index))
+				if (helper->StartHandler(*mSharedData, key, tokenizer.Value(), isArrayElement, index))
 				{
-					ParseMembers(jsonValue);
+					ParseMembers(tokenizer);
 					helper->EndHandler(*mSharedData, key);
+					handled = true;
 					break;
 				}
 			}
 
+			if (handled == false)
+			{
+				tokenizer.Skip();
+			}
+
 			mSharedData->DecrementDepth();
 		}
-		else if (jsonValue.isArray())
+		else if (token == JsonTokenizer::TokenType::BeginArray)
 		{
 			std::size_t arrIndex = 0;
-			// todo: check if it is an object or not if(value.isObject())
-			for (; arrIndex < jsonValue.size(); ++arrIndex)
+			for (token = tokenizer.Next(); token != JsonTokenizer::TokenType::EndArray; token = tokenizer.Next(), ++arrIndex)
 			{
-				const auto& element = jsonValue[static_cast<int>(arrIndex)];
-				if (element.isObject())
+				if (token == JsonTokenizer::TokenType::BeginObject)
 				{
 					mSharedData->IncrementDepth();
-					ParseMembers(element, true, arrIndex);
+					ParseMembers(tokenizer, true, arrIndex);
 					mSharedData->DecrementDepth();
 				}
 				else
 				{
-					Parse(key, element, true, arrIndex);
+					Parse(tokenizer, token, key, true, arrIndex);
 				}
 			}
 		}
 		else // is a Primitive
 		{
+			assert(token == JsonTokenizer::TokenType::Value);
 			for (IJsonParseHelper* helper : mListOfHelpers)
 			{
-				if (helper->StartHandler(*mSharedData, key, jsonValue, isArrayElement, index))
+				if (helper->StartHandler(*mSharedData, key, tokenizer.Value(), isArrayElement, index))
 				{
 					helper->EndHandler(*mSharedData, key);
 					break;
@@ -210,33 +229,25 @@ namespace Library
 		}
 	}
 
-	void JsonParseMaster::ParseMembers(const Json::Value& jsonValue, bool isArrayElement, std::size_t index)
+	void JsonParseMaster::ParseMembers(JsonTokenizer& tokenizer, bool isArrayElement, std::size_t index)
 	{
-		if (jsonValue.size() > 0)
+		for (JsonTokenizer::TokenType token = tokenizer.Next(); token != JsonTokenizer::TokenType::EndObject; token = tokenizer.Next())
 		{
-			const std::vector<std::string> keys = jsonValue.getMemberNames();
-
-			for (const std::string& key : keys)
-			{
-				auto& value = jsonValue[key];
-				Parse(key, value, isArrayElement, index);
-			}
+			assert(token == JsonTokenizer::TokenType::Key);
+			// the key stays good while its value is read, nested objects have their own key buffers
+			const std::string_view key = tokenizer.Key();
+			Parse(tokenizer, tokenizer.Next(), key, isArrayElement, index);
 		}
 	}
 
 	void JsonParseMaster::ParseFromFile(const std::string& fileName)
 	{
 		Initialize();
-		std::ifstream jsonFile(fileName);
-
-		if (!(jsonFile.good()))
-		{
-			throw std::runtime_error("Bad File");
-		}
+		const MappedFile jsonFile(fileName);
 
 		mFileName = fileName;
 
-		Parse(jsonFile);
+		Parse(jsonFile.Contents());
 	}
 
 	const std::string& JsonParseMaster::GetFileName() const
@@ -1,12 +1,10 @@
 #pragma once
 
-#pragma warning(push)
-#pragma warning(disable: 26812)
-#include "json/json.h"
-#pragma warning(pop)
 #include <gsl/gsl>
+#include <string_view>
 #include "vector.h"
 #include "RTTI.h"
+#include "JsonTokenizer.h"
 
 namespace Library
 {
@@ -156,17 +154,20 @@ namespace Library
 		void RemoveHelper(IJsonParseHelper& helper);
 
 		/// <summary>
-		/// Parse a string of Json data.
+		/// Parse a string of Json data in place, without copying it.
+		/// Keys and strings without escapes reach the helpers as views into jsonData.
 		/// </summary>
 		/// <param name="jsonData">a string of Json data.</param>
-		void Parse(const std::string& jsonData);
+		void Parse(std::string_view jsonData);
 		/// <summary>
 		/// Parse an input stream of Json data (std::istream).
+		/// The stream is tokenized as it is read and the helpers are called as each key/value pair arrives,
+		/// so no document tree is built and members are handled in the order they appear.
 		/// </summary>
 		/// <param name="jsonInputStream">an input stream of Json data (std::istream).</param>
 		void Parse(std::istream& jsonInputStream);
 		/// <summary>
-		/// given a filename, read in the file and parse it.
+		/// given a filename, map the file into memory and parse it in place.
 		/// </summary>
 		/// <param name="fileName">string of filename</param>
 		void ParseFromFile(const std::string& fileName);
@@ -207,18 +208,27 @@ namespace Library
 
 	private:
 		/// <summary>
-		/// Retrieves the members from a Json::Value object and Parse's each of them.
+		/// Parses a whole document, which must be an object.
 		/// </summary>
-		/// <param name="jsonValue">Json::Value object</param>
-		void ParseMembers(const Json::Value& jsonValue, bool isArrayElement = false, std::size_t index = 0);
+		/// <param name="tokenizer">tokenizer at the start of the document</param>
+		void Parse(JsonTokenizer& tokenizer);
 		/// <summary>
-		/// Given a key/value pair (string/Json::Value) and a bool indicating if the value is an element of an array, trigger the chain of responsibility. 
+		/// Reads the members of the object whose BeginObject token was just read and Parse's each of them, up to its EndObject.
 		/// </summary>
+		/// <param name="tokenizer">tokenizer over the document</param>
+		/// <param name="isArrayElement">bool</param>
+		/// <param name="index">size_t</param>
+		void ParseMembers(JsonTokenizer& tokenizer, bool isArrayElement = false, std::size_t index = 0);
+		/// <summary>
+		/// Given a key and the token just read for its value, and a bool indicating if the value is an element of an array, trigger the chain of responsibility.
+		/// Objects and arrays are read to their end.
+		/// </summary>
+		/// <param name="tokenizer">tokenizer over the document</param>
+		/// <param name="token">type of the token just read</param>
 		/// <param name="key">string</param>
-		/// <param name="jsonValue">Json::Value object</param>
 		/// <param name="isArrayElement">bool</param>
 		/// <param name="index">size_t</param>
-		void Parse(const std::string& key, const Json::Value& jsonValue, bool isArrayElement = false, std::size_t index = 0);
+		void Parse(JsonTokenizer& tokenizer, JsonTokenizer::TokenType token, std::string_view key, bool isArrayElement = false, std::size_t index = 0);
 
 		Vector<IJsonParseHelper*> mListOfHelpers;
 		SharedData* mSharedData{ nullptr };
@@ -1,9 +1,22 @@
 #include "pch.h"
 #include "JsonTableParseHelper.h"
 #include "Sector.h"
+#include "ReactionDispatcher.h"
 
 namespace Library
 {
+	namespace
+	{
+		template <typename T>
+		void CopyValues(const Datum& from, Datum& into)
+		{
+			for (std::size_t i = 0; i < from.Size(); ++i)
+			{
+				into.Set(from.Get<T>(i), i);
+			}
+		}
+	}
+
 #pragma region Shared Data
 
 	RTTI_DEFINITIONS(JsonTableParseHelper::SharedData)
@@ -35,6 +48,16 @@ namespace Library
 		mScopeSharedData = &scopeSharedData;
 	}
 
+	Arena* JsonTableParseHelper::SharedData::GetArena() const
+	{
+		return mArena;
+	}
+
+	void JsonTableParseHelper::SharedData::SetArena(Arena* arena)
+	{
+		mArena = arena;
+	}
+
 #pragma endregion
 
 #pragma region Json Test Parse Helper
@@ -49,99 +72,131 @@ namespace Library
 		while (mContextStack.Size() > 0) mContextStack.Pop();
 	}
 
-	bool JsonTableParseHelper::StartHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey, const Json::Value& jsonValue, bool isArrayElement, std::size_t index)
+	bool JsonTableParseHelper::StartHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey, const JsonValue& jsonValue, bool isArrayElement, std::size_t index)
 	{
 		JsonTableParseHelper::SharedData* tempSharedData = sharedData.As<JsonTableParseHelper::SharedData>();
 		if (tempSharedData == nullptr) return false;
 
+		if (jsonKey == "class" || jsonKey == "type" || jsonKey == "value")
+		{
+			if (mContextStack.IsEmpty())
+			{
+				throw std::runtime_error("Json \"" + std::string(jsonKey) + "\" has to be in a member's object");
+			}
+		}
+
 		if (jsonKey == "class")
 		{
-			assert(mContextStack.IsEmpty() == false);
 			Context& contextFrame = mContextStack.Top();
+			contextFrame.className = jsonValue.AsString();
 
-			contextFrame.className = jsonValue.asString();
+			// the value came first and its scope was made before the class was known
+			if (contextFrame.built != nullptr && contextFrame.builtIndex == index && contextFrame.builtClass != contextFrame.className)
+			{
+				Rebuild(contextFrame, tempSharedData->GetArena());
+				ReactionDispatcher::SyncLoaded(*contextFrame.built);
+			}
 		}
 
 		else if (jsonKey == "type")
 		{
-			assert(mContextStack.IsEmpty() == false);
 			Context& contextFrame = mContextStack.Top();
-			const auto& type = jsonValue.asString();
+			contextFrame.type = Datum::StringToDatumTypesMap[std::string(jsonValue.AsString())];
 
-			contextFrame.type = Datum::StringToDatumTypesMap[type];
+			Arena::Guard guard(tempSharedData->GetArena());
 			Datum& datum = contextFrame.scope->Append(contextFrame.key);
-			datum.SetType(contextFrame.type);
+			if (datum.SetType(contextFrame.type) == false)
+			{
+				throw std::runtime_error("Json member \"" + contextFrame.key + "\" has a value that is not of its type");
+			}
+
+			for (const PendingValue& pending : contextFrame.pending)
+			{
+				SetValue(datum, JsonValue(pending.type, pending.text), pending.index);
+			}
+			contextFrame.pending.Clear();
 		}
 
 		else if (jsonKey == "value")
 		{
-			assert(mContextStack.IsEmpty() == false);
 			Context& contextFrame = mContextStack.Top();
-			Datum* d = contextFrame.scope->Find(contextFrame.key);
-			assert(d != nullptr);
-			Datum& datum = *d;
-			
-			if (datum.Type() == Datum::DatumTypes::Table)
+			Datum* datum = contextFrame.scope->Find(contextFrame.key);
+
+			if (datum == nullptr || datum->Type() == Datum::DatumTypes::Unknown)
 			{
-				Scope* nestedScope;
-				if (datum.Size() > index)
+				if (jsonValue.IsObject() == false)
 				{
-					nestedScope = &(datum.operator[](index));
+					// the type is still to come, the value is kept until it does
+					contextFrame.pending.PushBack({ index, jsonValue.Type(), std::string(jsonValue.AsString()) });
+					return true;
 				}
-				else if (contextFrame.className.empty() == false)
+
+				// only a table has an object for its value, its members are parsed next so the scope can't wait for the type
+				Arena::Guard guard(tempSharedData->GetArena());
+				datum = &contextFrame.scope->Append(contextFrame.key);
+				datum->SetType(Datum::DatumTypes::Table);
+			}
+			
+			if (datum->Type() == Datum::DatumTypes::Table)
+			{
+				Scope* nestedScope;
+				if (datum->Size() > index)
 				{
-					nestedScope = Factory<Scope>::Create(contextFrame.className);
-					assert(nestedScope != nullptr);
-					contextFrame.scope->Adopt(*nestedScope, contextFrame.key);
+					nestedScope = &(datum->operator[](index));
 				}
 				else
 				{
-					nestedScope = &(contextFrame.scope->AppendScope(contextFrame.key));
+					// only the tree goes in the arena, the context stack below outlives the parse
+					if (contextFrame.className.empty() == false)
+					{
+						// made outside the arena, a constructor can register its product with things that outlive the parse
+						nestedScope = Factory<Scope>::Create(contextFrame.className);
+						Arena::Guard guard(tempSharedData->GetArena());
+						contextFrame.scope->Adopt(*nestedScope, contextFrame.key);
+					}
+					else
+					{
+						Arena::Guard guard(tempSharedData->GetArena());
+						nestedScope = &(contextFrame.scope->AppendScope(contextFrame.key));
+					}
+
+					contextFrame.built = nestedScope;
+					contextFrame.builtIndex = index;
+					contextFrame.builtClass = contextFrame.className;
 				}
 
 				if (isArrayElement)
 				{
-					mContextStack.Push({ jsonKey, Datum::DatumTypes::Table, std::string(), nestedScope });
+					mContextStack.Push({ std::string(jsonKey), Datum::DatumTypes::Table, std::string(), nestedScope, nestedScope });
 				}
 				else
 				{
-					contextFrame.scope = nestedScope;
+					contextFrame.nested = nestedScope;
 				}				
 			}
 			else
 			{
-				switch (datum.Type())
-				{
-				case Datum::DatumTypes::Integer:
-					datum.Set(jsonValue.asInt(), index);
-					break;
-				case Datum::DatumTypes::Float:
-					datum.Set(jsonValue.asFloat(), index);
-					break;
-				case Datum::DatumTypes::String:
-					datum.Set(jsonValue.asString(), index);
-					break;
-				case Datum::DatumTypes::Vector:
-				case Datum::DatumTypes::Matrix:
-				default:
-					datum.SetFromString(jsonValue.asString(), index);
-					break;
-				}
+				Arena::Guard guard(tempSharedData->GetArena());
+				SetValue(*datum, jsonValue, index);
 			}
 		}
 		
 		else
 		{
-			Scope* scope = (mContextStack.IsEmpty() ? tempSharedData->GetSharedData() : mContextStack.Top().scope);
+			Scope* scope = tempSharedData->GetSharedData();
+			if (mContextStack.IsEmpty() == false)
+			{
+				const Context& parentFrame = mContextStack.Top();
+				scope = (parentFrame.nested != nullptr ? parentFrame.nested : parentFrame.scope);
+			}
 			assert(scope != nullptr);
-			Context contextFrame({ jsonKey, Datum::DatumTypes::Unknown, std::string(), scope });
-			mContextStack.Push(contextFrame);			
+			mContextStack.Push({ std::string(jsonKey), Datum::DatumTypes::Unknown, std::string(), scope });
 		}
 			   
 		return true;
 	}
 
-	bool JsonTableParseHelper::EndHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey)
+	bool JsonTableParseHelper::EndHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey)
 	{
 		// todo: do an "Is" check (slightly cheaper) dont need the pointer after
 		JsonTableParseHelper::SharedData* tempSharedData = sharedData.As<JsonTableParseHelper::SharedData>();
@@ -149,12 +204,126 @@ namespace Library
 
 		if (mContextStack.Top().key == jsonKey)
 		{
+			if (mContextStack.Top().pending.IsEmpty() == false)
+			{
+				throw std::runtime_error("Json member \"" + std::string(jsonKey) + "\" has a value but no type");
+			}
+
+			// a reaction is routed by the subtype it was parsed with from the next event on
+			if (jsonKey == "SubType")
+			{
+				ReactionDispatcher::SyncLoaded(*mContextStack.Top().scope);
+			}
 			mContextStack.Pop();
 		}
 
 		return true;
 	}
 
+	void JsonTableParseHelper::SetValue(Datum& datum, const JsonValue& jsonValue, std::size_t index)
+	{
+		switch (datum.Type())
+		{
+		case Datum::DatumTypes::Integer:
+			datum.Set(jsonValue.AsInt(), index);
+			break;
+		case Datum::DatumTypes::Float:
+			datum.Set(jsonValue.AsFloat(), index);
+			break;
+		case Datum::DatumTypes::String:
+			datum.Set(std::string(jsonValue.AsString()), index);
+			break;
+		case Datum::DatumTypes::Vector:
+		case Datum::DatumTypes::Matrix:
+		default:
+			datum.SetFromString(std::string(jsonValue.AsString()), index);
+			break;
+		}
+	}
+
+	void JsonTableParseHelper::Rebuild(Context& contextFrame, Arena* arena)
+	{
+		Scope* built = contextFrame.built;
+		gsl::owner<Scope*> product = Factory<Scope>::Create(contextFrame.className);
+		Arena::Guard guard(arena);
+
+		try
+		{
+			for (Scope::HashTablePair* pair : built->GetOrderedVector())
+			{
+				const Symbol& key = pair->first;
+				Datum& from = pair->second;
+
+				if (from.Type() == Datum::DatumTypes::Table)
+				{
+					// adopting takes the child out of from, so the children are gathered first
+					Vector<Scope*> children;
+					children.Reserve(from.Size());
+					for (std::size_t i = 0; i < from.Size(); ++i)
+					{
+						children.PushBack(&from[i]);
+					}
+
+					for (Scope* child : children)
+					{
+						product->Adopt(*child, key);
+					}
+					continue;
+				}
+
+				Datum& into = product->Append(key);
+				if (into.Type() != Datum::DatumTypes::Unknown && (into.Type() != from.Type() || (into.IsExternal() && into.Size() != from.Size())))
+				{
+					throw std::runtime_error("Json member \"" + contextFrame.key + "\" has values that do not fit class " + contextFrame.className);
+				}
+
+				if (into.IsExternal() == false)
+				{
+					into = from;
+					continue;
+				}
+
+				switch (from.Type())
+				{
+				case Datum::DatumTypes::Integer:
+					CopyValues<std::int32_t>(from, into);
+					break;
+				case Datum::DatumTypes::Float:
+					CopyValues<std::float_t>(from, into);
+					break;
+				case Datum::DatumTypes::Vector:
+					CopyValues<glm::vec4>(from, into);
+					break;
+				case Datum::DatumTypes::Matrix:
+					CopyValues<glm::mat4>(from, into);
+					break;
+				case Datum::DatumTypes::String:
+					CopyValues<std::string>(from, into);
+					break;
+				default:
+					// Json has no pointers, nothing else can be parsed into a scope
+					break;
+				}
+			}
+		}
+		catch (...)
+		{
+			delete product;
+			throw;
+		}
+
+		// the destructor takes the old scope out of its datum, the rebuilt one takes its place at the end
+		delete built;
+		contextFrame.scope->Adopt(*product, contextFrame.key);
+
+		if (contextFrame.nested == built)
+		{
+			contextFrame.nested = product;
+		}
+		contextFrame.built = product;
+		contextFrame.builtClass = contextFrame.className;
+	}
+
 	gsl::owner<IJsonParseHelper*> JsonTableParseHelper::Create() const
 	{
 		return new JsonTableParseHelper();
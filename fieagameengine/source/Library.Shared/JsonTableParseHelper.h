@@ -2,6 +2,7 @@
 #include "IJsonParseHelper.h"
 #include "Stack.h"
 #include "Scope.h"
+#include "Arena.h"
 
 namespace Library
 {
@@ -58,8 +59,23 @@ namespace Library
 			Scope* GetSharedData();
 			void SetSharedData(Scope& scopeSharedData);
 
+			/// <summary>
+			/// Gets the arena the parsed Scopes, Datums and tables are allocated from, nullptr for the heap
+			/// </summary>
+			/// <returns>arena pointer</returns>
+			Arena* GetArena() const;
+			/// <summary>
+			/// Sets the arena to build the parsed tree in: plain nested Scopes, attributes and their values.
+			/// Scopes of a class are made by their factory on the heap, only what the parse adds to them goes in the arena.
+			/// The arena has to outlive the parsed Scope tree, and the root Scope should be created after it,
+			/// so the whole tree is gone before the arena releases its blocks
+			/// </summary>
+			/// <param name="arena">arena to allocate from, nullptr for the heap</param>
+			void SetArena(Arena* arena);
+
 		private:
 			Scope* mScopeSharedData{ nullptr };
+			Arena* mArena{ nullptr };
 		};
 		/// <summary>
 		/// Constructor (default)
@@ -92,18 +108,18 @@ namespace Library
 		virtual void Initialize() override;
 		/// <summary>
 		/// Given a shared data reference, a string for the Json key, 
-		/// a reference to the Json::Value object, 
+		/// a reference to the JsonValue, 
 		/// and a bool indicating if the value is an array element, 
 		/// attempt to handle the key/value pair. 
 		/// If this routine does indeed handle the pair, return true, otherwise return false.
 		/// </summary>
 		/// <param name="sharedData">ParseMaster Shared Data</param>
 		/// <param name="jsonKey">String</param>
-		/// <param name="jsonValueRef">Json::Value</param>
+		/// <param name="jsonValueRef">JsonValue</param>
 		/// <param name="isArrayElement">bool</param>
 		/// <param name="index">size_t</param>
 		/// <returns>bool</returns>
-		virtual bool StartHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey, const Json::Value& jsonValue, bool isArrayElement = false, std::size_t index = 0) override;
+		virtual bool StartHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey, const JsonValue& jsonValue, bool isArrayElement = false, std::size_t index = 0) override;
 		/// <summary>
 		/// Given a shared data reference, a string for the Json key, 
 		/// attempt to complete the handling of the element pair. 
@@ -113,7 +129,7 @@ namespace Library
 		/// <param name="sharedData">ParseMaster Shared Data</param>
 		/// <param name="jsonKey">string</param>
 		/// <returns>bool</returns>
-		virtual bool EndHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey) override;
+		virtual bool EndHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey) override;
 		/// <summary>
 		/// overridden implementations will create an instance of the helper
 		/// </summary>
@@ -122,14 +138,35 @@ namespace Library
 
 	private:
 
+		/// <summary>
+		/// A primitive value read before the "type" of its member, set once the type is known
+		/// </summary>
+		struct PendingValue
+		{
+			std::size_t index{ 0 };
+			JsonValue::ValueType type{ JsonValue::ValueType::Null };
+			std::string text{ "" };
+		};
+
+		/// <summary>
+		/// A member being parsed. Its "class", "type" and "value" can come in any order
+		/// </summary>
 		struct Context
 		{
 			const std::string key{ "" };
 			Datum::DatumTypes type{ Datum::DatumTypes::Unknown };
 			std::string className{ "" };
-			Scope* scope{ nullptr };
+			Scope* scope{ nullptr }; // scope the member's datum is in
+			Scope* nested{ nullptr }; // scope the members of an object "value" go in
+			Scope* built{ nullptr }; // last scope made for an object "value", rebuilt if its "class" comes after it
+			std::size_t builtIndex{ 0 };
+			std::string builtClass{ "" };
+			Vector<PendingValue> pending;
 		};
 
+		static void SetValue(Datum& datum, const JsonValue& jsonValue, std::size_t index);
+		static void Rebuild(Context& contextFrame, Arena* arena);
+
 		Stack<Context> mContextStack;
 
 	};
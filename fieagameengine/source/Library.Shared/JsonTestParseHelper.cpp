@@ -33,7 +33,7 @@ namespace Library
 		mArrayCount = 0;
 	}
 
-	bool JsonTestParseHelper::StartHandler(JsonParseMaster::SharedData& sharedData, const std::string& /*jsonKey*/, const Json::Value& /*jsonObjectRef*/, bool isArrayElement, std::size_t /*index*/)
+	bool JsonTestParseHelper::StartHandler(JsonParseMaster::SharedData& sharedData, std::string_view /*jsonKey*/, const JsonValue& /*jsonValueRef*/, bool isArrayElement, std::size_t /*index*/)
 	{
 		JsonTestParseHelper::SharedData* tempSharedData = sharedData.As<JsonTestParseHelper::SharedData>();
 		// todo:: remove assert and just return false, 
@@ -51,7 +51,7 @@ namespace Library
 		return true;
 	}
 
-	bool JsonTestParseHelper::EndHandler(JsonParseMaster::SharedData& sharedData, const std::string& /*jsonKey*/)
+	bool JsonTestParseHelper::EndHandler(JsonParseMaster::SharedData& sharedData, std::string_view /*jsonKey*/)
 	{
 		// todo: do an "Is" check (slightly cheaper) dont need the pointer after
 		JsonTestParseHelper::SharedData* tempSharedData = sharedData.As<JsonTestParseHelper::SharedData>();
@@ -61,18 +61,18 @@ namespace Library
 		virtual void Initialize() override;
 		/// <summary>
 		/// Given a shared data reference, a string for the Json key, 
-		/// a reference to the Json::Value object, 
+		/// a reference to the JsonValue, 
 		/// and a bool indicating if the value is an array element, 
 		/// attempt to handle the key/value pair. 
 		/// If this routine does indeed handle the pair, return true, otherwise return false.
 		/// </summary>
 		/// <param name="sharedData">ParseMaster Shared Data</param>
 		/// <param name="jsonKey">String</param>
-		/// <param name="jsonValueRef">Json::Value</param>
+		/// <param name="jsonValueRef">JsonValue</param>
 		/// <param name="isArrayElement">bool</param>
 		/// <param name="index">size_t</param>
 		/// <returns>bool</returns>
-		virtual bool StartHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey, const Json::Value& jsonValueRef, bool isArrayElement = false, std::size_t index = 0) override;
+		virtual bool StartHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey, const JsonValue& jsonValueRef, bool isArrayElement = false, std::size_t index = 0) override;
 		/// <summary>
 		/// Given a shared data reference, a string for the Json key, 
 		/// attempt to complete the handling of the element pair. 
@@ -82,7 +82,7 @@ namespace Library
 		/// <param name="sharedData">ParseMaster Shared Data</param>
 		/// <param name="jsonKey">string</param>
 		/// <returns>bool</returns>
-		virtual bool EndHandler(JsonParseMaster::SharedData& sharedData, const std::string& jsonKey) override;
+		virtual bool EndHandler(JsonParseMaster::SharedData& sharedData, std::string_view jsonKey) override;
 		/// <summary>
 		/// overridden implementations will create an instance of the helper
 		/// </summary>
@@ -0,0 +1,401 @@
+#include "pch.h"
+#include "JsonTokenizer.h"
+#include <charconv>
+
+namespace Library
+{
+	JsonTokenizer::JsonTokenizer(std::istream& input) :
+		mInput(input.rdbuf())
+	{
+		if (mInput == nullptr)
+		{
+			throw std::runtime_error("Stream has no buffer");
+		}
+	}
+
+	JsonTokenizer::JsonTokenizer(std::string_view text) :
+		mCursor(text.data()), mEnd(text.data() + text.size())
+	{
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Next()
+	{
+		int c = SkipWhitespace();
+
+		switch (mState)
+		{
+		case State::Value:
+			return ReadValue(c);
+
+		case State::ObjectNext:
+			if (c == '}') return Close('{');
+			Expect(',');
+			c = SkipWhitespace();
+			[[fallthrough]];
+		case State::ObjectKey:
+			if (c != '"') Fail("expected a key");
+			Get();
+			mKey = ReadString(*mKeyBuffers[mContainers.Size() - 1]);
+			SkipWhitespace();
+			Expect(':');
+			mState = State::Value;
+			return TokenType::Key;
+
+		case State::ObjectFirst:
+			if (c == '}') return Close('{');
+			mState = State::ObjectKey;
+			return Next();
+
+		case State::ArrayNext:
+			if (c == ']') return Close('[');
+			Expect(',');
+			return ReadValue(SkipWhitespace());
+
+		case State::ArrayFirst:
+			if (c == ']') return Close('[');
+			return ReadValue(c);
+
+		case State::Done:
+		default:
+			if (c != std::char_traits<char>::eof()) Fail("unexpected data after the document");
+			return TokenType::End;
+		}
+	}
+
+	void JsonTokenizer::Skip()
+	{
+		std::size_t depth = 1;
+		while (depth > 0)
+		{
+			switch (Next())
+			{
+			case TokenType::BeginObject:
+			case TokenType::BeginArray:
+				++depth;
+				break;
+			case TokenType::EndObject:
+			case TokenType::EndArray:
+				--depth;
+				break;
+			case TokenType::End:
+				Fail("unexpected end of the document");
+			default:
+				break;
+			}
+		}
+	}
+
+	std::string_view JsonTokenizer::Key() const
+	{
+		return mKey;
+	}
+
+	const JsonValue& JsonTokenizer::Value() const
+	{
+		return mValue;
+	}
+
+	std::size_t JsonTokenizer::Line() const
+	{
+		return mLine;
+	}
+
+	int JsonTokenizer::Peek()
+	{
+		if (mInput != nullptr)
+		{
+			return mInput->sgetc();
+		}
+		return (mCursor != mEnd ? static_cast<unsigned char>(*mCursor) : std::char_traits<char>::eof());
+	}
+
+	int JsonTokenizer::Get()
+	{
+		int c;
+		if (mInput != nullptr)
+		{
+			c = mInput->sbumpc();
+		}
+		else
+		{
+			if (mCursor == mEnd) return std::char_traits<char>::eof();
+			c = static_cast<unsigned char>(*mCursor++);
+		}
+
+		if (c == '\n') ++mLine;
+		return c;
+	}
+
+	int JsonTokenizer::SkipWhitespace()
+	{
+		for (;;)
+		{
+			const int c = Peek();
+			if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+			{
+				Get();
+			}
+			else if (c == '/')
+			{
+				Get();
+				const int kind = Get();
+				if (kind == '/')
+				{
+					for (int end = Get(); end != '\n' && end != std::char_traits<char>::eof(); end = Get());
+				}
+				else if (kind == '*')
+				{
+					for (int previous = 0, end = Get(); previous != '*' || end != '/'; previous = end, end = Get())
+					{
+						if (end == std::char_traits<char>::eof()) Fail("unterminated comment");
+					}
+				}
+				else
+				{
+					Fail("expected a comment");
+				}
+			}
+			else
+			{
+				return c;
+			}
+		}
+	}
+
+	void JsonTokenizer::Expect(char expected)
+	{
+		if (Get() != expected)
+		{
+			Fail(std::string("expected '") + expected + "'");
+		}
+	}
+
+	std::string_view JsonTokenizer::ReadString(std::string& buffer)
+	{
+		buffer.clear();
+		if (mInput == nullptr)
+		{
+			// scan for the closing quote, the text itself is the string unless an escape turns up
+			const char* begin = mCursor;
+			const char* end = begin;
+			for (; end != mEnd && *end != '"' && *end != '\\'; ++end)
+			{
+				if (*end == '\n') ++mLine;
+			}
+
+			mCursor = end;
+			if (end != mEnd && *end == '"')
+			{
+				++mCursor;
+				return std::string_view(begin, end - begin);
+			}
+			buffer.assign(begin, end);
+		}
+
+		DecodeString(buffer);
+		return buffer;
+	}
+
+	void JsonTokenizer::DecodeString(std::string& string)
+	{
+		for (;;)
+		{
+			int c = Get();
+			if (c == '"') return;
+			if (c == std::char_traits<char>::eof()) Fail("unterminated string");
+			if (c != '\\')
+			{
+				string.push_back(static_cast<char>(c));
+				continue;
+			}
+
+			c = Get();
+			switch (c)
+			{
+			case '"': string.push_back('"'); break;
+			case '\\': string.push_back('\\'); break;
+			case '/': string.push_back('/'); break;
+			case 'b': string.push_back('\b'); break;
+			case 'f': string.push_back('\f'); break;
+			case 'n': string.push_back('\n'); break;
+			case 'r': string.push_back('\r'); break;
+			case 't': string.push_back('\t'); break;
+			case 'u':
+			{
+				auto readHex = [this]()
+				{
+					unsigned int unit = 0;
+					for (int i = 0; i < 4; ++i)
+					{
+						const int digit = Get();
+						unit <<= 4;
+						if (digit >= '0' && digit <= '9') unit |= digit - '0';
+						else if (digit >= 'a' && digit <= 'f') unit |= digit - 'a' + 10;
+						else if (digit >= 'A' && digit <= 'F') unit |= digit - 'A' + 10;
+						else Fail("bad unicode escape");
+					}
+					return unit;
+				};
+
+				unsigned int codePoint = readHex();
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					Expect('\\');
+					Expect('u');
+					const unsigned int low = readHex();
+					if (low < 0xDC00 || low > 0xDFFF) Fail("bad unicode surrogate pair");
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+
+				// UTF-8, as JsonCpp stores it
+				if (codePoint < 0x80)
+				{
+					string.push_back(static_cast<char>(codePoint));
+				}
+				else if (codePoint < 0x800)
+				{
+					string.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+					string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else if (codePoint < 0x10000)
+				{
+					string.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+					string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else
+				{
+					string.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+					string.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+					string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				break;
+			}
+			default:
+				Fail("bad escape sequence");
+			}
+		}
+	}
+
+	void JsonTokenizer::ReadLiteral(const char* literal)
+	{
+		for (; *literal != '\0'; ++literal)
+		{
+			Expect(*literal);
+		}
+	}
+
+	void JsonTokenizer::ReadNumber()
+	{
+		auto isNumber = [](int c) { return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'; };
+
+		std::string_view text;
+		if (mInput == nullptr)
+		{
+			const char* begin = mCursor;
+			for (; mCursor != mEnd && isNumber(static_cast<unsigned char>(*mCursor)); ++mCursor);
+			text = std::string_view(begin, mCursor - begin);
+		}
+		else
+		{
+			mString.clear();
+			while (isNumber(Peek()))
+			{
+				mString.push_back(static_cast<char>(Get()));
+			}
+			text = mString;
+		}
+
+		// conversion waits for the helper, only the syntax is checked here
+		double value;
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+		if (text.empty() || end != text.data() + text.size() || error == std::errc::invalid_argument)
+		{
+			Fail("bad number");
+		}
+
+		const bool isReal = text.find_first_of(".eE") != std::string_view::npos;
+		mValue = JsonValue(isReal ? JsonValue::ValueType::Real : JsonValue::ValueType::Integer, text);
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::ReadValue(int c)
+	{
+		switch (c)
+		{
+		case '{':
+			Get();
+			mContainers.PushBack('{');
+			// indexed by container depth, array levels just leave theirs unused
+			while (mKeyBuffers.Size() < mContainers.Size())
+			{
+				mKeyBufferList.PushBack(std::string());
+				mKeyBuffers.PushBack(&mKeyBufferList.Back());
+			}
+			mState = State::ObjectFirst;
+			mValue = JsonValue(JsonValue::ValueType::Object);
+			return TokenType::BeginObject;
+
+		case '[':
+			Get();
+			mContainers.PushBack('[');
+			mState = State::ArrayFirst;
+			mValue = JsonValue(JsonValue::ValueType::Array);
+			return TokenType::BeginArray;
+
+		case '"':
+			Get();
+			mValue = JsonValue(JsonValue::ValueType::String, ReadString(mString));
+			break;
+
+		case 't':
+			ReadLiteral("true");
+			mValue = JsonValue(JsonValue::ValueType::Boolean, "true");
+			break;
+
+		case 'f':
+			ReadLiteral("false");
+			mValue = JsonValue(JsonValue::ValueType::Boolean, "false");
+			break;
+
+		case 'n':
+			ReadLiteral("null");
+			mValue = JsonValue();
+			break;
+
+		default:
+			if (c != '-' && (c < '0' || c > '9')) Fail("expected a value");
+			ReadNumber();
+			break;
+		}
+
+		AfterValue();
+		return TokenType::Value;
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Close(char container)
+	{
+		Get();
+		assert(mContainers.IsEmpty() == false && mContainers.Back() == container);
+		mContainers.PopBack();
+		AfterValue();
+		return (container == '{' ? TokenType::EndObject : TokenType::EndArray);
+	}
+
+	void JsonTokenizer::AfterValue()
+	{
+		if (mContainers.IsEmpty())
+		{
+			mState = State::Done;
+		}
+		else
+		{
+			mState = (mContainers.Back() == '{' ? State::ObjectNext : State::ArrayNext);
+		}
+	}
+
+	void JsonTokenizer::Fail(const std::string& message) const
+	{
+		throw std::runtime_error("Json parse error at line " + std::to_string(mLine) + ": " + message);
+	}
+}
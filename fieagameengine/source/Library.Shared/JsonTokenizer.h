@@ -0,0 +1,135 @@
+#pragma once
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include "JsonValue.h"
+#include "SList.h"
+#include "vector.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Pull tokenizer over Json text in memory or in a stream.
+	/// Reads one token at a time, so only the current key or value and the stack of open objects and arrays
+	/// are held, never the whole document. Over text in memory, keys and values without escapes are views
+	/// straight into the text; otherwise they are decoded into buffers the tokenizer reuses.
+	/// Accepts the same // and /* */ comments as JsonCpp's reader.
+	/// </summary>
+	class JsonTokenizer final
+	{
+	public:
+		/// <summary>
+		/// Kinds of tokens returned by Next
+		/// </summary>
+		enum class TokenType
+		{
+			BeginObject,
+			EndObject,
+			BeginArray,
+			EndArray,
+			Key,
+			Value,
+			End
+		};
+
+		/// <summary>
+		/// Constructor
+		/// </summary>
+		/// <param name="input">stream of Json text, read from its current position</param>
+		explicit JsonTokenizer(std::istream& input);
+		/// <summary>
+		/// Constructor
+		/// </summary>
+		/// <param name="text">Json text, which must outlive the tokenizer and the views it hands out</param>
+		explicit JsonTokenizer(std::string_view text);
+		/// <summary>
+		/// Copy Constructor (deleted)
+		/// </summary>
+		JsonTokenizer(const JsonTokenizer& rhs) = delete;
+		/// <summary>
+		/// Copy Assignment (deleted)
+		/// </summary>
+		JsonTokenizer& operator=(const JsonTokenizer& rhs) = delete;
+		/// <summary>
+		/// Move Constructor (deleted)
+		/// </summary>
+		JsonTokenizer(JsonTokenizer&& rhs) = delete;
+		/// <summary>
+		/// Move Assignment (deleted)
+		/// </summary>
+		JsonTokenizer& operator=(JsonTokenizer&& rhs) = delete;
+		/// <summary>
+		/// Destructor
+		/// </summary>
+		~JsonTokenizer() = default;
+
+		/// <summary>
+		/// Reads the next token, throws a std::runtime_error with the line number if the text is not valid Json
+		/// </summary>
+		/// <returns>type of the token, End once the document is complete</returns>
+		TokenType Next();
+		/// <summary>
+		/// Reads tokens until the object or array whose Begin token was just returned is closed
+		/// </summary>
+		void Skip();
+
+		/// <summary>
+		/// Gets the last key read, good until the next key of the same object or the end of that object,
+		/// so it can be held while the key's value is read
+		/// </summary>
+		/// <returns>view of the key</returns>
+		std::string_view Key() const;
+		/// <summary>
+		/// Gets the last value read, good until the next call to Next.
+		/// A primitive (string, number, bool or null) after a Value token, an object or array with no text after a Begin token as its members are still to come
+		/// </summary>
+		/// <returns>JsonValue</returns>
+		const JsonValue& Value() const;
+		/// <summary>
+		/// Gets the line the tokenizer has reached
+		/// </summary>
+		/// <returns>1 based line number</returns>
+		std::size_t Line() const;
+
+	private:
+		enum class State
+		{
+			Value,
+			ObjectFirst,
+			ObjectKey,
+			ObjectNext,
+			ArrayFirst,
+			ArrayNext,
+			Done
+		};
+
+		int Peek();
+		int Get();
+		int SkipWhitespace();
+		void Expect(char expected);
+		std::string_view ReadString(std::string& buffer);
+		void DecodeString(std::string& buffer);
+		void ReadLiteral(const char* literal);
+		void ReadNumber();
+		TokenType ReadValue(int c);
+		TokenType Close(char container);
+		void AfterValue();
+		[[noreturn]] void Fail(const std::string& message) const;
+
+		// either a stream, or the cursor and end of text in memory
+		std::streambuf* mInput{ nullptr };
+		const char* mCursor{ nullptr };
+		const char* mEnd{ nullptr };
+
+		Vector<char> mContainers;
+		State mState{ State::Value };
+		std::string_view mKey;
+		// one key buffer per open object, the list keeps their addresses stable as the nesting grows
+		SList<std::string> mKeyBufferList;
+		Vector<std::string*> mKeyBuffers;
+		std::string mString;
+		JsonValue mValue;
+		std::size_t mLine{ 1 };
+	};
+}
@@ -0,0 +1,83 @@
+#include "pch.h"
+#include "JsonValue.h"
+#include <charconv>
+#include <limits>
+
+namespace Library
+{
+	JsonValue::JsonValue(ValueType type, std::string_view text) :
+		mType(type), mText(text)
+	{
+	}
+
+	JsonValue::ValueType JsonValue::Type() const
+	{
+		return mType;
+	}
+
+	bool JsonValue::IsObject() const
+	{
+		return mType == ValueType::Object;
+	}
+
+	bool JsonValue::IsArray() const
+	{
+		return mType == ValueType::Array;
+	}
+
+	std::string_view JsonValue::AsString() const
+	{
+		return mText;
+	}
+
+	std::int32_t JsonValue::AsInt() const
+	{
+		if (mType == ValueType::Integer)
+		{
+			std::int32_t value = 0;
+			const auto [end, error] = std::from_chars(mText.data(), mText.data() + mText.size(), value);
+			if (error != std::errc() || end != mText.data() + mText.size())
+			{
+				throw std::runtime_error("Json integer out of range");
+			}
+			return value;
+		}
+
+		const double value = AsDouble();
+		if (value < static_cast<double>(std::numeric_limits<std::int32_t>::min()) || value > static_cast<double>(std::numeric_limits<std::int32_t>::max()))
+		{
+			throw std::runtime_error("Json number out of range");
+		}
+		return static_cast<std::int32_t>(value);
+	}
+
+	float JsonValue::AsFloat() const
+	{
+		return static_cast<float>(AsDouble());
+	}
+
+	bool JsonValue::AsBool() const
+	{
+		return AsDouble() != 0.0;
+	}
+
+	double JsonValue::AsDouble() const
+	{
+		switch (mType)
+		{
+		case ValueType::Null:
+			return 0.0;
+		case ValueType::Boolean:
+			return (mText == "true" ? 1.0 : 0.0);
+		case ValueType::Integer:
+		case ValueType::Real:
+		{
+			double value = 0.0;
+			std::from_chars(mText.data(), mText.data() + mText.size(), value);
+			return value;
+		}
+		default:
+			throw std::runtime_error("Json value is not a number");
+		}
+	}
+}
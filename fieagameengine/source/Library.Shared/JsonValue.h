@@ -0,0 +1,103 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace Library
+{
+	/// <summary>
+	/// A Json value as handed to the parse helpers, a view over its text in the document or in the tokenizer's buffer.
+	/// Nothing is copied or converted until one of the As functions is called, and the view is only good during the handler call.
+	/// Objects and arrays carry no text, their members are read after the handler starts.
+	/// </summary>
+	class JsonValue final
+	{
+	public:
+		/// <summary>
+		/// Kinds of Json values
+		/// </summary>
+		enum class ValueType
+		{
+			Null,
+			Boolean,
+			Integer,
+			Real,
+			String,
+			Object,
+			Array
+		};
+
+		/// <summary>
+		/// Default Constructor, a null value
+		/// </summary>
+		JsonValue() = default;
+		/// <summary>
+		/// Constructor
+		/// </summary>
+		/// <param name="type">kind of value</param>
+		/// <param name="text">string contents, number as written, true or false, empty otherwise</param>
+		JsonValue(ValueType type, std::string_view text = std::string_view());
+		/// <summary>
+		/// Copy Constructor (default)
+		/// </summary>
+		JsonValue(const JsonValue&) = default;
+		/// <summary>
+		/// Move Constructor (default)
+		/// </summary>
+		JsonValue(JsonValue&&) noexcept = default;
+		/// <summary>
+		/// Copy Assignment (default)
+		/// </summary>
+		JsonValue& operator=(const JsonValue&) = default;
+		/// <summary>
+		/// Move Assignment (default)
+		/// </summary>
+		JsonValue& operator=(JsonValue&&) noexcept = default;
+		/// <summary>
+		/// Destructor (default)
+		/// </summary>
+		~JsonValue() = default;
+
+		/// <summary>
+		/// Gets the kind of value
+		/// </summary>
+		/// <returns>ValueType</returns>
+		ValueType Type() const;
+		/// <summary>
+		/// Returns true if the value is an object
+		/// </summary>
+		/// <returns>bool</returns>
+		bool IsObject() const;
+		/// <summary>
+		/// Returns true if the value is an array
+		/// </summary>
+		/// <returns>bool</returns>
+		bool IsArray() const;
+
+		/// <summary>
+		/// Gets the text of the value: a string's contents, a number as written, true or false, empty for null
+		/// </summary>
+		/// <returns>view that is only good during the handler call</returns>
+		std::string_view AsString() const;
+		/// <summary>
+		/// Converts a number, bool or null to an integer, reals are truncated. Throws for strings, containers and numbers out of range
+		/// </summary>
+		/// <returns>int32_t</returns>
+		std::int32_t AsInt() const;
+		/// <summary>
+		/// Converts a number, bool or null to a float. Throws for strings and containers
+		/// </summary>
+		/// <returns>float_t</returns>
+		float AsFloat() const;
+		/// <summary>
+		/// Converts a bool, number or null to a bool. Throws for strings and containers
+		/// </summary>
+		/// <returns>bool</returns>
+		bool AsBool() const;
+
+	private:
+		double AsDouble() const;
+
+		ValueType mType{ ValueType::Null };
+		std::string_view mText;
+	};
+}
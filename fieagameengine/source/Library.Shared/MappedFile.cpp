@@ -0,0 +1,121 @@
+#include "pch.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Library
+{
+	MappedFile::MappedFile(const std::string& fileName)
+	{
+#ifdef _WIN32
+		HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			throw std::runtime_error("Bad File");
+		}
+
+		LARGE_INTEGER size;
+		if (GetFileSizeEx(file, &size) == FALSE)
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Bad File");
+		}
+		mSize = static_cast<std::size_t>(size.QuadPart);
+
+		// an empty file cannot be mapped, it just has no contents
+		if (mSize > 0)
+		{
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping != nullptr)
+			{
+				mData = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+				// the view keeps the mapping alive
+				CloseHandle(mapping);
+			}
+		}
+		CloseHandle(file);
+#else
+		const int file = open(fileName.c_str(), O_RDONLY);
+		if (file == -1)
+		{
+			throw std::runtime_error("Bad File");
+		}
+
+		struct stat status;
+		if (fstat(file, &status) == -1)
+		{
+			close(file);
+			throw std::runtime_error("Bad File");
+		}
+		mSize = static_cast<std::size_t>(status.st_size);
+
+		// an empty file cannot be mapped, it just has no contents
+		if (mSize > 0)
+		{
+			void* data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+			mData = (data == MAP_FAILED ? nullptr : static_cast<const char*>(data));
+		}
+		close(file);
+#endif
+
+		if (mSize > 0 && mData == nullptr)
+		{
+			throw std::runtime_error("Could not map file");
+		}
+	}
+
+	MappedFile::MappedFile(MappedFile&& rhs) noexcept :
+		mData(rhs.mData), mSize(rhs.mSize)
+	{
+		rhs.mData = nullptr;
+		rhs.mSize = 0;
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Unmap();
+			mData = rhs.mData;
+			mSize = rhs.mSize;
+
+			rhs.mData = nullptr;
+			rhs.mSize = 0;
+		}
+
+		return *this;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Unmap();
+	}
+
+	std::string_view MappedFile::Contents() const
+	{
+		return std::string_view(mData, mSize);
+	}
+
+	void MappedFile::Unmap()
+	{
+		if (mData != nullptr)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(mData);
+#else
+			munmap(const_cast<char*>(mData), mSize);
+#endif
+			mData = nullptr;
+		}
+		mSize = 0;
+	}
+}
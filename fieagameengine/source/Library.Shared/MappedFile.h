@@ -0,0 +1,55 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace Library
+{
+	/// <summary>
+	/// Read only memory mapping of a whole file.
+	/// The OS pages the contents in as they are read, nothing is copied into the process.
+	/// </summary>
+	class MappedFile final
+	{
+	public:
+		/// <summary>
+		/// Constructor, maps the file, throws if it cannot be opened
+		/// </summary>
+		/// <param name="fileName">path of the file</param>
+		explicit MappedFile(const std::string& fileName);
+		/// <summary>
+		/// Copy Constructor (deleted)
+		/// </summary>
+		MappedFile(const MappedFile& rhs) = delete;
+		/// <summary>
+		/// Copy Assignment (deleted)
+		/// </summary>
+		MappedFile& operator=(const MappedFile& rhs) = delete;
+		/// <summary>
+		/// Move Constructor
+		/// </summary>
+		/// <param name="rhs">Takes in a MappedFile&&</param>
+		MappedFile(MappedFile&& rhs) noexcept;
+		/// <summary>
+		/// Move Assignment
+		/// </summary>
+		/// <param name="rhs">Takes in a MappedFile&&</param>
+		/// <returns>Moved MappedFile</returns>
+		MappedFile& operator=(MappedFile&& rhs) noexcept;
+		/// <summary>
+		/// Destructor, unmaps the file
+		/// </summary>
+		~MappedFile();
+
+		/// <summary>
+		/// Gets the contents of the file
+		/// </summary>
+		/// <returns>view that is good as long as this MappedFile</returns>
+		std::string_view Contents() const;
+
+	private:
+		void Unmap();
+
+		const char* mData{ nullptr };
+		std::size_t mSize{ 0 };
+	};
+}
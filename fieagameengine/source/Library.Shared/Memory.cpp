@@ -0,0 +1,155 @@
+#include "pch.h"
+#include "Memory.h"
+#include "Arena.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#if defined(DEBUG) || defined(_DEBUG)
+#include <crtdbg.h>
+#endif
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// Placed in front of every allocation, records the owning arena (nullptr for the heap) and the requested size
+		/// </summary>
+		struct alignas(Arena::MaxAlignment) Header final
+		{
+			Arena* Owner;
+			std::size_t Size;
+		};
+
+		Header* HeaderOf(void* data)
+		{
+			return static_cast<Header*>(data) - 1;
+		}
+
+		thread_local bool sUntracked{ false };
+
+		void* HeapAllocate(std::size_t size)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			if (sUntracked)
+			{
+				return _malloc_dbg(size, _CRT_BLOCK, __FILE__, __LINE__);
+			}
+#endif
+			return malloc(size);
+		}
+
+		void* HeapReallocate(void* memory, std::size_t size)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			// an untracked block stays untracked whichever thread resizes it
+			if (_BLOCK_TYPE(_CrtReportBlockType(memory)) == _CRT_BLOCK)
+			{
+				return _realloc_dbg(memory, size, _CRT_BLOCK, __FILE__, __LINE__);
+			}
+#endif
+			return realloc(memory, size);
+		}
+
+		void HeapFree(void* memory)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			if (_BLOCK_TYPE(_CrtReportBlockType(memory)) == _CRT_BLOCK)
+			{
+				_free_dbg(memory, _CRT_BLOCK);
+				return;
+			}
+#endif
+			free(memory);
+		}
+	}
+
+#pragma region UntrackedGuard
+
+	Memory::UntrackedGuard::UntrackedGuard() :
+		mPrevious(sUntracked)
+	{
+		sUntracked = true;
+	}
+
+	Memory::UntrackedGuard::~UntrackedGuard()
+	{
+		sUntracked = mPrevious;
+	}
+
+#pragma endregion UntrackedGuard
+
+	void* Memory::Allocate(std::size_t size)
+	{
+		// untracked data lives until the program exits, it never goes in an arena
+		Arena* arena = (sUntracked ? nullptr : Arena::Current());
+		void* memory = (arena != nullptr ? arena->Allocate(sizeof(Header) + size) : HeapAllocate(sizeof(Header) + size));
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		Header* header = new (memory) Header{ arena, size };
+		return header + 1;
+	}
+
+	void* Memory::Reallocate(void* data, std::size_t size)
+	{
+		if (data == nullptr)
+		{
+			return Allocate(size);
+		}
+
+		if (size == 0)
+		{
+			Free(data);
+			return nullptr;
+		}
+
+		Header* header = HeaderOf(data);
+		Arena* owner = header->Owner;
+		if (owner != nullptr && owner != Arena::Current())
+		{
+			// the arena only grows on the thread building into it, anything resized afterwards moves to the heap
+			void* moved = HeapAllocate(sizeof(Header) + size);
+			if (moved == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			std::memcpy(static_cast<Header*>(moved) + 1, data, std::min(header->Size, size));
+			Header* movedHeader = new (moved) Header{ nullptr, size };
+			return movedHeader + 1;
+		}
+
+		void* memory = (owner != nullptr ? owner->Reallocate(header, sizeof(Header) + header->Size, sizeof(Header) + size) : HeapReallocate(header, sizeof(Header) + size));
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		header = static_cast<Header*>(memory);
+		header->Size = size;
+		return header + 1;
+	}
+
+	void Memory::Free(void* data)
+	{
+		if (data == nullptr)
+		{
+			return;
+		}
+
+		Header* header = HeaderOf(data);
+		if (header->Owner == nullptr)
+		{
+			HeapFree(header);
+		}
+	}
+
+	bool Memory::IsArenaAllocation(const void* data)
+	{
+		return HeaderOf(const_cast<void*>(data))->Owner != nullptr;
+	}
+}
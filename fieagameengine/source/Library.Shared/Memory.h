@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+
+namespace Library
+{
+	/// <summary>
+	/// Allocation entry point for the engine's containers (Vector, SList, Datum, FlatHashmap) and Scope objects.
+	/// Allocates from the thread's current Arena when one is set by Arena::Guard, and from the heap otherwise.
+	/// Every allocation remembers where it came from, so it can be freed later whether or not an arena is current.
+	/// Arena memory only grows while its arena is current on the calling thread, resizing it at any other time moves it to the heap.
+	/// </summary>
+	class Memory final
+	{
+	public:
+		Memory() = delete;
+
+		/// <summary>
+		/// While alive, allocations made through Memory on the calling thread are for data that lives until the program exits:
+		/// they come from the heap even while an arena is current, and are left out of the debug heap's memory state checkpoints
+		/// (they are made as CRT blocks). Other threads are not affected, and release builds only skip the arena.
+		/// </summary>
+		class UntrackedGuard final
+		{
+		public:
+			/// <summary>
+			/// Constructor
+			/// </summary>
+			UntrackedGuard();
+			UntrackedGuard(const UntrackedGuard&) = delete;
+			UntrackedGuard(UntrackedGuard&&) = delete;
+			UntrackedGuard& operator=(const UntrackedGuard&) = delete;
+			UntrackedGuard& operator=(UntrackedGuard&&) = delete;
+			/// <summary>
+			/// Destructor, restores the previous mode of the thread
+			/// </summary>
+			~UntrackedGuard();
+
+		private:
+			bool mPrevious{ false };
+		};
+
+		/// <summary>
+		/// Allocates size bytes, aligned to Arena::MaxAlignment
+		/// </summary>
+		/// <param name="size">number of bytes</param>
+		/// <returns>pointer to the memory, throws std::bad_alloc on failure</returns>
+		static void* Allocate(std::size_t size);
+		/// <summary>
+		/// Resizes an allocation. Arena memory stays in its arena while that arena is current on the calling thread and is copied to the heap otherwise,
+		/// heap memory stays on the heap. Behaves like Allocate for nullptr and like Free for a size of 0.
+		/// </summary>
+		/// <param name="data">pointer from Allocate or Reallocate, or nullptr</param>
+		/// <param name="size">new number of bytes</param>
+		/// <returns>pointer to the resized memory, nullptr for a size of 0</returns>
+		static void* Reallocate(void* data, std::size_t size);
+		/// <summary>
+		/// Frees an allocation, a no-op for arena memory (the arena releases it all at once)
+		/// </summary>
+		/// <param name="data">pointer from Allocate or Reallocate, or nullptr</param>
+		static void Free(void* data);
+		/// <summary>
+		/// Tells whether an allocation was made by an arena rather than the heap
+		/// </summary>
+		/// <param name="data">pointer from Allocate or Reallocate</param>
+		/// <returns>true for arena memory</returns>
+		static bool IsArenaAllocation(const void* data);
+	};
+}
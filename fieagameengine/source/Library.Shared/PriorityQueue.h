@@ -0,0 +1,96 @@
+#pragma once
+#include "vector.h"
+#include <functional>
+
+namespace Library
+{
+	/// <summary>
+	/// Binary min-heap over a Vector: Top is the item that orders first under TLess.
+	/// Push and Pop are O(log n), Top is O(1), and items with equal keys come out in no particular order.
+	/// </summary>
+	template <typename T, typename TLess = std::less<T>>
+	class PriorityQueue final
+	{
+	public:
+		/// <summary>
+		/// Default Constructor
+		/// </summary>
+		/// <param name="capacity">number of items to reserve room for</param>
+		/// <param name="less">ordering of the items</param>
+		explicit PriorityQueue(std::size_t capacity = 0, TLess less = TLess());
+		PriorityQueue(const PriorityQueue& rhs) = default;
+		PriorityQueue(PriorityQueue&& rhs) noexcept = default;
+		PriorityQueue& operator=(const PriorityQueue& rhs) = default;
+		PriorityQueue& operator=(PriorityQueue&& rhs) noexcept = default;
+		~PriorityQueue() = default;
+
+		/// <summary>
+		/// Adds an item
+		/// </summary>
+		/// <param name="value">item to add</param>
+		void Push(const T& value);
+		/// <summary>
+		/// Adds an item
+		/// </summary>
+		/// <param name="value">item to add</param>
+		void Push(T&& value);
+		/// <summary>
+		/// Removes the top item, throws if the queue is empty
+		/// </summary>
+		/// <exception cref="runtime_error">PriorityQueue is empty.</exception>
+		void Pop();
+		/// <summary>
+		/// Moves the top item out and removes it, throws if the queue is empty
+		/// </summary>
+		/// <returns>the removed item</returns>
+		/// <exception cref="runtime_error">PriorityQueue is empty.</exception>
+		T PopTop();
+
+		/// <summary>
+		/// Gets the item that orders first, throws if the queue is empty
+		/// </summary>
+		/// <returns>top item</returns>
+		/// <exception cref="runtime_error">PriorityQueue is empty.</exception>
+		const T& Top() const;
+
+		/// <summary>
+		/// Return a bool indicating whether the queue contains any items
+		/// </summary>
+		/// <returns>true if empty and false if not</returns>
+		bool IsEmpty() const;
+		/// <summary>
+		/// return the number of items in the queue
+		/// </summary>
+		/// <returns>number of items</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Reserves room for capacity items
+		/// </summary>
+		/// <param name="capacity">number of items</param>
+		void Reserve(std::size_t capacity);
+		/// <summary>
+		/// remove all items, memory is preserved
+		/// </summary>
+		void Clear();
+		/// <summary>
+		/// releases the memory not used by items
+		/// </summary>
+		void ShrinkToFit();
+
+	private:
+		/// <summary>
+		/// Moves the item at index up until its parent orders before it
+		/// </summary>
+		void SiftUp(std::size_t index);
+		/// <summary>
+		/// Moves the item at index down until both children order after it
+		/// </summary>
+		void SiftDown(std::size_t index);
+
+		Vector<T> mHeap;
+		TLess mLess;
+	};
+}
+
+#include "PriorityQueue.inl"
@@ -0,0 +1,139 @@
+#include "PriorityQueue.h"
+#include <utility>
+
+namespace Library
+{
+	template <typename T, typename TLess>
+	inline PriorityQueue<T, TLess>::PriorityQueue(std::size_t capacity, TLess less) :
+		mHeap(capacity), mLess(std::move(less))
+	{
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::Push(const T& value)
+	{
+		mHeap.PushBack(value);
+		SiftUp(mHeap.Size() - 1);
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::Push(T&& value)
+	{
+		mHeap.PushBack(std::move(value));
+		SiftUp(mHeap.Size() - 1);
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::Pop()
+	{
+		if (mHeap.IsEmpty())
+		{
+			throw std::runtime_error("PriorityQueue is empty.");
+		}
+
+		using std::swap;
+		swap(mHeap[0], mHeap[mHeap.Size() - 1]);
+		mHeap.PopBack();
+
+		if (!mHeap.IsEmpty())
+		{
+			SiftDown(0);
+		}
+	}
+
+	template <typename T, typename TLess>
+	inline T PriorityQueue<T, TLess>::PopTop()
+	{
+		if (mHeap.IsEmpty())
+		{
+			throw std::runtime_error("PriorityQueue is empty.");
+		}
+
+		T top = std::move(mHeap[0]);
+		Pop();
+		return top;
+	}
+
+	template <typename T, typename TLess>
+	inline const T& PriorityQueue<T, TLess>::Top() const
+	{
+		if (mHeap.IsEmpty())
+		{
+			throw std::runtime_error("PriorityQueue is empty.");
+		}
+
+		return mHeap[0];
+	}
+
+	template <typename T, typename TLess>
+	inline bool PriorityQueue<T, TLess>::IsEmpty() const
+	{
+		return mHeap.IsEmpty();
+	}
+
+	template <typename T, typename TLess>
+	inline std::size_t PriorityQueue<T, TLess>::Size() const
+	{
+		return mHeap.Size();
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::Reserve(std::size_t capacity)
+	{
+		mHeap.Reserve(capacity);
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::Clear()
+	{
+		mHeap.Clear();
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::ShrinkToFit()
+	{
+		mHeap.ShrinkToFit();
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::SiftUp(std::size_t index)
+	{
+		using std::swap;
+		while (index > 0)
+		{
+			const std::size_t parent = (index - 1) / 2;
+			if (!mLess(mHeap[index], mHeap[parent]))
+			{
+				break;
+			}
+
+			swap(mHeap[index], mHeap[parent]);
+			index = parent;
+		}
+	}
+
+	template <typename T, typename TLess>
+	inline void PriorityQueue<T, TLess>::SiftDown(std::size_t index)
+	{
+		using std::swap;
+		const std::size_t size = mHeap.Size();
+		for (;;)
+		{
+			const std::size_t left = 2 * index + 1;
+			if (left >= size)
+			{
+				break;
+			}
+
+			const std::size_t right = left + 1;
+			const std::size_t smallest = (right < size && mLess(mHeap[right], mHeap[left])) ? right : left;
+			if (!mLess(mHeap[smallest], mHeap[index]))
+			{
+				break;
+			}
+
+			swap(mHeap[index], mHeap[smallest]);
+			index = smallest;
+		}
+	}
+}
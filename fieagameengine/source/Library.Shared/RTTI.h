@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cstddef>
+#include <cstdint>
 
 namespace Library
 {
@@ -9,37 +10,112 @@ namespace Library
 	{
 	public:
 		using IdType = std::size_t;
+		static constexpr std::size_t MaxDepth = 16;
+
+		// A type and its ancestors indexed by depth, the first class under RTTI at 0 and the type itself at Depth - 1.
+		// Built once per type from its parent's, so an ancestry check is a bounds check and a compare instead of a virtual call per level.
+		struct Ancestry final
+		{
+			Ancestry() = default;
+			Ancestry(const Ancestry& parent, IdType id, const char* name) :
+				Depth(parent.Depth + 1)
+			{
+				for (std::size_t i = 0; i < parent.Depth; ++i)
+				{
+					Ids[i] = parent.Ids[i];
+					NameHashes[i] = parent.NameHashes[i];
+					Names[i] = parent.Names[i];
+				}
+				Ids[parent.Depth] = id;
+				NameHashes[parent.Depth] = HashName(name);
+				Names[parent.Depth] = name;
+			}
+
+			IdType Ids[MaxDepth]{};
+			std::uint64_t NameHashes[MaxDepth]{};
+			const char* Names[MaxDepth]{};
+			std::size_t Depth{ 0 };
+		};
+
+		// 64 bit FNV-1a
+		static constexpr std::uint64_t HashName(const char* name)
+		{
+			std::uint64_t hash = 14695981039346656037ULL;
+			for (; *name != '\0'; ++name)
+			{
+				hash = (hash ^ static_cast<std::uint8_t>(*name)) * 1099511628211ULL;
+			}
+			return hash;
+		}
+
 		static IdType TypeIdClass() { return 0; }
+		static constexpr std::size_t TypeDepth() { return 0; }
+		static const Ancestry& TypeAncestry()
+		{
+			static const Ancestry root;
+			return root;
+		}
 
 		virtual ~RTTI() = default;
 
 		virtual Library::RTTI::IdType TypeIdInstance() const = 0;
 
+		virtual const Ancestry& AncestryInstance() const
+		{
+			return TypeAncestry();
+		}
+
 		virtual RTTI* QueryInterface(const IdType)
 		{
 			return nullptr;
 		}
 
-		virtual bool Is(IdType) const
+		bool Is(IdType id) const
 		{
+			// the depth of id is unknown, walk up from the most derived type
+			const Ancestry& ancestry = AncestryInstance();
+			for (std::size_t i = ancestry.Depth; i > 0; --i)
+			{
+				if (ancestry.Ids[i - 1] == id)
+				{
+					return true;
+				}
+			}
 			return false;
 		}
 
-		virtual bool Is(const std::string&) const
+		bool Is(const std::string& name) const
 		{
+			const std::uint64_t hash = HashName(name.c_str());
+			const Ancestry& ancestry = AncestryInstance();
+			for (std::size_t i = ancestry.Depth; i > 0; --i)
+			{
+				if (ancestry.NameHashes[i - 1] == hash && name == ancestry.Names[i - 1])
+				{
+					return true;
+				}
+			}
 			return false;
 		}
 
+		template <typename T>
+		bool Is() const
+		{
+			constexpr std::size_t depth = T::TypeDepth();
+			const Ancestry& ancestry = AncestryInstance();
+			return (depth > 0 && depth <= ancestry.Depth && ancestry.Ids[depth - 1] == T::TypeIdClass());
+		}
+
 		template <typename T>
 		const T* As() const
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<const T*>(this) : nullptr);
+			return (Is<T>() ? reinterpret_cast<const T*>(this) : nullptr);
 		}
 
 		template <typename T>
 		T* As()
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
+			return (Is<T>() ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
 		}
 
 		virtual std::string ToString() const
@@ -62,13 +138,17 @@ namespace Library
             {																													\
 				return (id == sRunTimeTypeId ? reinterpret_cast<Library::RTTI*>(this) : ParentType::QueryInterface(id)); \
             }																													\
-			bool Is(Library::RTTI::IdType id) const override																			\
+			static constexpr std::uint64_t TypeNameHash() { return Library::RTTI::HashName(#Type); }									\
+			static constexpr std::size_t TypeDepth() { return ParentType::TypeDepth() + 1; }										\
+			static_assert(ParentType::TypeDepth() < Library::RTTI::MaxDepth, "RTTI hierarchy is deeper than RTTI::MaxDepth");	\
+			static const Library::RTTI::Ancestry& TypeAncestry()																	\
 			{																													\
-				return (id == sRunTimeTypeId ? true : ParentType::Is(id));														\
+				static const Library::RTTI::Ancestry ancestry(ParentType::TypeAncestry(), TypeIdClass(), #Type);					\
+				return ancestry;																								\
 			}																													\
-			bool Is(const std::string& name) const override																\
+			const Library::RTTI::Ancestry& AncestryInstance() const override													\
 			{																													\
-				return (name == TypeName() ? true : ParentType::Is(name));														\
+				return TypeAncestry();																							\
 			}																													\
 			private:																											\
 				static const Library::RTTI::IdType sRunTimeTypeId;
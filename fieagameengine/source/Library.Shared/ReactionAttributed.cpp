@@ -2,6 +2,7 @@
 #include "Event.h"
 #include "EventMessageAttributed.h"
 #include "ReactionAttributed.h"
+#include "ReactionDispatcher.h"
 #include "World.h"
 
 namespace Library
@@ -16,38 +17,92 @@ namespace Library
 	ReactionAttributed::ReactionAttributed(const std::string& name) : 
 		Reaction(TypeIdClass(), name)
 	{
-		Event<EventMessageAttributed>::Subscribe(*this);
+		ReactionDispatcher::Register(*this);
+	}
+
+	ReactionAttributed::ReactionAttributed(const ReactionAttributed& rhs) :
+		Reaction(rhs), mSubtype(rhs.mSubtype)
+	{
+		ReactionDispatcher::Register(*this);
+	}
+
+	ReactionAttributed::ReactionAttributed(ReactionAttributed&& rhs) noexcept :
+		Reaction(std::move(rhs)), mSubtype(std::move(rhs.mSubtype))
+	{
+		// rhs stays registered under its old subtype until it is destroyed
+		ReactionDispatcher::Register(*this);
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(const ReactionAttributed& rhs)
+	{
+		if (this != &rhs)
+		{
+			Reaction::operator=(rhs);
+			mSubtype = rhs.mSubtype;
+			SyncSubtype();
+		}
+
+		return *this;
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(ReactionAttributed&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Reaction::operator=(std::move(rhs));
+			mSubtype = std::move(rhs.mSubtype);
+			SyncSubtype();
+		}
+
+		return *this;
 	}
 
 	ReactionAttributed::~ReactionAttributed()
 	{
-		Event<EventMessageAttributed>::Unsubscribe(*this);
+		ReactionDispatcher::Unregister(*this);
 	}
 
 	void ReactionAttributed::Notify(const IEventPublisher& event)
 	{
-		assert(event.Is(Event<EventMessageAttributed>::TypeIdClass()));
-
-		const Event<EventMessageAttributed>& eventMessageAttributed = static_cast<const Event<EventMessageAttributed>&>(event);
-		const EventMessageAttributed& payload = eventMessageAttributed.Message();
+		const IEventPublisher* events = &event;
+		NotifyBatch(&events, 1);
+	}
 
-		if (payload.GetSubType() == mSubtype)
+	void ReactionAttributed::NotifyBatch(const IEventPublisher* const* events, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
 		{
-			Scope params;
+			assert(events[i]->Is<Event<EventMessageAttributed>>());
+
+			const Event<EventMessageAttributed>& eventMessageAttributed = static_cast<const Event<EventMessageAttributed>&>(*events[i]);
+			const EventMessageAttributed& payload = eventMessageAttributed.Message();
 
-			for (auto& attribute : payload.GetAuxiliaryAttributes())
+			if (payload.GetSubType() == mSubtype)
 			{
-				auto& datum = params.Append(attribute->first);
-				datum = attribute->second;
+				React(payload);
 			}
-
-			payload.GetWorld()->GetWorldState().GetCallStack().Push(std::move(params));
-			ActionList::Update(payload.GetWorld()->GetWorldState());
-			payload.GetWorld()->GetWorldState().GetCallStack().Pop();
-			
 		}
 	}
 
+	void ReactionAttributed::Update(WorldState& worldState)
+	{
+		SyncSubtype();
+		Reaction::Update(worldState);
+	}
+
+	void ReactionAttributed::React(const EventMessageAttributed& payload)
+	{
+		WorldState& worldState = payload.GetWorld()->GetWorldState();
+		worldState.GetCallStack().Push(CallFrame(payload));
+		ActionList::Update(worldState);
+		worldState.GetCallStack().Pop();
+	}
+
+	void ReactionAttributed::SyncSubtype()
+	{
+		ReactionDispatcher::Sync(*this);
+	}
+
 	Vector<Signature> ReactionAttributed::Signatures()
 	{
 		Vector<Signature> signatures = Reaction::Signatures();
@@ -65,6 +120,7 @@ namespace Library
 	void ReactionAttributed::SetSubtype(const std::string& subtype)
 	{
 		mSubtype = subtype;
+		SyncSubtype();
 	}
 
 	const std::string& ReactionAttributed::GetSubtype() const
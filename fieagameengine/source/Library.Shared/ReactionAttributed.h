@@ -1,9 +1,16 @@
 #pragma once
 #include "Reaction.h"
 #include "Factory.h"
+#include "Symbol.h"
 
 namespace Library
 {
+	class EventMessageAttributed;
+
+	/// <summary>
+	/// Reaction to Event of EventMessageAttributed of one subtype.
+	/// Events reach it through the ReactionDispatcher, which only hands it the events of its subtype.
+	/// </summary>
 	class ReactionAttributed final : public Reaction
 	{
 		RTTI_DECLARATIONS(ReactionAttributed, Reaction)
@@ -21,25 +28,25 @@ namespace Library
 		/// Copy Constructor
 		/// </summary>
 		/// <param name="rhs">Takes in a const ReactionAttributed reference</param>
-		ReactionAttributed(const ReactionAttributed& rhs) = default;
+		ReactionAttributed(const ReactionAttributed& rhs);
 		/// <summary>
 		/// Move Constructor
 		/// </summary>
 		/// <param name="rhs">Takes in a ReactionAttributed&&</param>
 		/// <returns>Moved ReactionAttributed</returns>
-		ReactionAttributed(ReactionAttributed&& rhs) = default;
+		ReactionAttributed(ReactionAttributed&& rhs) noexcept;
 		/// <summary>
 		/// Copy Assignment
 		/// </summary>
 		/// <param name="rhs">Takes in a const ReactionAttributed reference</param>
 		/// <returns>Copied ReactionAttributed</returns>
-		ReactionAttributed& operator=(const ReactionAttributed& rhs) = default;
+		ReactionAttributed& operator=(const ReactionAttributed& rhs);
 		/// <summary>
 		/// Move Assignment
 		/// </summary>
 		/// <param name="rhs">Takes in a ReactionAttributed&&</param>
 		/// <returns>Moved ReactionAttributed</returns>
-		ReactionAttributed& operator=(ReactionAttributed&& rhs) = default;
+		ReactionAttributed& operator=(ReactionAttributed&& rhs) noexcept;
 		/// <summary>
 		/// Destructor
 		/// </summary>
@@ -52,6 +59,18 @@ namespace Library
 		/// </summary>
 		/// <param name="event">address of an EventPublisher</param>
 		void Notify(const IEventPublisher& event) override;
+		/// <summary>
+		/// Reacts to every EventMessageAttributed of a batch whose subtype matches, in order
+		/// </summary>
+		/// <param name="events">Event of EventMessageAttributed</param>
+		/// <param name="count">number of events</param>
+		void NotifyBatch(const IEventPublisher* const* events, std::size_t count) override;
+
+		/// <summary>
+		/// Picks up a subtype assigned through the SubType datum, e.g. by the parser, so the dispatcher routes by it from now on
+		/// </summary>
+		/// <param name="worldState">WorldState</param>
+		virtual void Update(WorldState& worldState) override;
 
 		/// <summary>
 		/// Contain Signature to Pass to TypeManager
@@ -67,6 +86,7 @@ namespace Library
 
 		/// <summary>
 		/// Datum of type string indicating value of event subtype to which this Reaction responds.
+		/// Takes effect right away, the reaction is registered for the new subtype.
 		/// </summary>
 		/// <param name="subtype">std::string</param>
 		void SetSubtype(const std::string& subtype);
@@ -78,7 +98,29 @@ namespace Library
 		const std::string& GetSubtype() const;
 
 	private:
+		friend class ReactionDispatcher;
+
+		/// <summary>
+		/// Runs the actions with the event's auxiliary attributes as parameters
+		/// </summary>
+		/// <param name="payload">message of the event</param>
+		void React(const EventMessageAttributed& payload);
+		/// <summary>
+		/// Moves the registration over to the current subtype if it changed
+		/// </summary>
+		void SyncSubtype();
+
 		std::string mSubtype;
+		Symbol mRegisteredSubtype;
+	};
+
+	/// <summary>
+	/// A reaction registers with the ReactionDispatcher when it is constructed, a pooled one would be handed events
+	/// </summary>
+	template <>
+	struct IsPooledProduct<ReactionAttributed> final
+	{
+		static constexpr bool Value = false;
 	};
 
 	ConcreteFactory(ReactionAttributed, Scope)
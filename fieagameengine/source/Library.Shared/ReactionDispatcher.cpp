@@ -0,0 +1,257 @@
+#include "pch.h"
+#include "ReactionDispatcher.h"
+#include "ReactionAttributed.h"
+#include "EventMessageAttributed.h"
+#include "Event.h"
+#include <cassert>
+#include <thread>
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// Dispatch running on this thread with the reactions it still has to hand the event to,
+		/// linked to the one it is nested in (a reaction that sends another event)
+		/// </summary>
+		struct Dispatch final
+		{
+			Vector<ReactionAttributed*>* Matches{ nullptr };
+			const Dispatch* Outer{ nullptr };
+		};
+
+		thread_local const Dispatch* sDispatch{ nullptr };
+
+		/// <summary>
+		/// Marks the current thread as running a dispatch, and holds its place in the reader count, for its lifetime
+		/// </summary>
+		class DispatchScope final
+		{
+		public:
+			DispatchScope(Vector<ReactionAttributed*>& matches, std::atomic<std::size_t>& readers) :
+				mDispatch{ &matches, sDispatch }, mReaders(readers)
+			{
+				sDispatch = &mDispatch;
+			}
+			DispatchScope(const DispatchScope&) = delete;
+			DispatchScope(DispatchScope&&) = delete;
+			DispatchScope& operator=(const DispatchScope&) = delete;
+			DispatchScope& operator=(DispatchScope&&) = delete;
+			~DispatchScope()
+			{
+				sDispatch = mDispatch.Outer;
+				mReaders.fetch_sub(1);
+			}
+
+		private:
+			Dispatch mDispatch;
+			std::atomic<std::size_t>& mReaders;
+		};
+	}
+
+	ReactionDispatcher ReactionDispatcher::mInstance;
+	ReactionDispatcher::TableType ReactionDispatcher::mReactionTable;
+	std::shared_mutex ReactionDispatcher::mMutex;
+	std::atomic<std::size_t> ReactionDispatcher::mPhase{ 0 };
+	std::atomic<std::size_t> ReactionDispatcher::mReaders[2]{};
+	std::mutex ReactionDispatcher::mGraceMutex;
+
+	void ReactionDispatcher::Register(ReactionAttributed& reaction)
+	{
+		std::unique_lock<std::shared_mutex> lock(mMutex);
+
+		// (un)subscribed under the lock, so a first reaction and a last one racing each other cannot leave it the wrong way round.
+		// Subscribing is a no-op while it is subscribed, and puts it back after Event<EventMessageAttributed>::UnsubscribeAll
+		Event<EventMessageAttributed>::Subscribe(mInstance);
+		reaction.mRegisteredSubtype = Symbol::Intern(reaction.mSubtype);
+		mReactionTable[reaction.mRegisteredSubtype].PushBack(&reaction);
+	}
+
+	void ReactionDispatcher::Unregister(ReactionAttributed& reaction)
+	{
+		{
+			std::unique_lock<std::shared_mutex> lock(mMutex);
+
+			Erase(reaction, reaction.mRegisteredSubtype);
+		}
+
+		// the dispatches on this thread skip it from here on, the ones on other threads are waited for
+		for (const Dispatch* dispatch = sDispatch; dispatch != nullptr; dispatch = dispatch->Outer)
+		{
+			for (ReactionAttributed*& match : *dispatch->Matches)
+			{
+				if (match == &reaction)
+				{
+					match = nullptr;
+				}
+			}
+		}
+		WaitForReaders();
+
+		{
+			std::shared_lock<std::shared_mutex> lock(mMutex);
+			if (mReactionTable.Size() != 0)
+			{
+				return;
+			}
+		}
+
+		// unsubscribing waits for the deliveries in progress, which take the lock, so it is done without it
+		Event<EventMessageAttributed>::Unsubscribe(mInstance);
+
+		// a reaction that registered meanwhile may have found the dispatcher still subscribed
+		std::unique_lock<std::shared_mutex> lock(mMutex);
+		if (mReactionTable.Size() != 0)
+		{
+			Event<EventMessageAttributed>::Subscribe(mInstance);
+		}
+	}
+
+	void ReactionDispatcher::Sync(ReactionAttributed& reaction)
+	{
+		std::unique_lock<std::shared_mutex> lock(mMutex);
+		Move(reaction);
+	}
+
+	void ReactionDispatcher::SyncLoaded(Scope& scope)
+	{
+		ReactionAttributed* reaction = scope.As<ReactionAttributed>();
+		if (reaction != nullptr)
+		{
+			Sync(*reaction);
+		}
+	}
+
+	void ReactionDispatcher::Move(ReactionAttributed& reaction)
+	{
+		if (reaction.mSubtype == reaction.mRegisteredSubtype.Name())
+		{
+			return;
+		}
+
+		const Symbol subtype = Symbol::Intern(reaction.mSubtype);
+		Erase(reaction, reaction.mRegisteredSubtype);
+		mReactionTable[subtype].PushBack(&reaction);
+		reaction.mRegisteredSubtype = subtype;
+	}
+
+	void ReactionDispatcher::WaitForReaders()
+	{
+		// a reaction waiting for its own dispatch would never return
+		if (sDispatch != nullptr)
+		{
+			return;
+		}
+
+		// dispatches starting from here on count in the other phase, only the ones already counted are waited for
+		std::scoped_lock<std::mutex> lock(mGraceMutex);
+		const std::size_t phase = mPhase.load();
+		mPhase.store(phase ^ 1);
+		while (mReaders[phase].load() != 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	std::size_t ReactionDispatcher::ReactionCount(const std::string& subtype)
+	{
+		const Symbol symbol = Symbol::TryFind(subtype);
+		if (!symbol.IsValid())
+		{
+			return 0;
+		}
+
+		std::shared_lock<std::shared_mutex> lock(mMutex);
+		auto it = mReactionTable.Find(symbol);
+		return (it != mReactionTable.end() ? it->second.Size() : 0);
+	}
+
+	void ReactionDispatcher::Notify(const IEventPublisher& event)
+	{
+		const IEventPublisher* events = &event;
+		NotifyBatch(&events, 1);
+	}
+
+	void ReactionDispatcher::Erase(ReactionAttributed& reaction, const Symbol& subtype)
+	{
+		auto it = mReactionTable.Find(subtype);
+		if (it == mReactionTable.end())
+		{
+			return;
+		}
+
+		Vector<ReactionAttributed*>& reactions = it->second;
+		reactions.Remove(&reaction);
+		if (reactions.IsEmpty())
+		{
+			// an empty subtype gives its memory back, nothing is held once the last reaction is gone
+			mReactionTable.Remove(it);
+		}
+	}
+
+	void ReactionDispatcher::NotifyBatch(const IEventPublisher* const* events, std::size_t count)
+	{
+		Vector<ReactionAttributed*> matches;
+
+		// counted before the table is read, so an unregister either takes the reaction out first or waits for this dispatch.
+		// Counted in the phase that is current once the count is in, a flip in between would not wait for it
+		std::size_t phase = mPhase.load();
+		mReaders[phase].fetch_add(1);
+		while (mPhase.load() != phase)
+		{
+			mReaders[phase].fetch_sub(1);
+			phase = mPhase.load();
+			mReaders[phase].fetch_add(1);
+		}
+		DispatchScope dispatching(matches, mReaders[phase]);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			assert(events[i]->Is<Event<EventMessageAttributed>>());
+			const EventMessageAttributed& payload = static_cast<const Event<EventMessageAttributed>&>(*events[i]).Message();
+
+			// a subtype that was never interned cannot have a reaction registered for it
+			const Symbol subtype = Symbol::TryFind(payload.GetSubType());
+			if (!subtype.IsValid())
+			{
+				continue;
+			}
+
+			// copied out so reactions can create reactions while they react
+			{
+				std::shared_lock<std::shared_mutex> lock(mMutex);
+				auto it = mReactionTable.Find(subtype);
+				if (it == mReactionTable.end())
+				{
+					continue;
+				}
+
+				matches.Resize(0);
+				for (ReactionAttributed* reaction : it->second)
+				{
+					matches.PushBack(reaction);
+				}
+			}
+
+			// a reaction whose subtype was changed through the datum since it registered does not react, it moves.
+			// Indexed, a reaction unregistered by another one while it reacts is nulled out in place
+			for (std::size_t match = 0; match < matches.Size(); ++match)
+			{
+				ReactionAttributed* reaction = matches[match];
+				if (reaction == nullptr)
+				{
+					continue;
+				}
+
+				if (reaction->mSubtype == payload.GetSubType())
+				{
+					reaction->React(payload);
+				}
+				else
+				{
+					Sync(*reaction);
+				}
+			}
+		}
+	}
+}
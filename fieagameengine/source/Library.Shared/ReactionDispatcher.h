@@ -0,0 +1,105 @@
+#pragma once
+#include "IEventSubscriber.h"
+#include "IEventPublisher.h"
+#include "Symbol.h"
+#include "hashmap.h"
+#include "Vector.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace Library
+{
+	class ReactionAttributed;
+	class Scope;
+
+	/// <summary>
+	/// Routes each Event of EventMessageAttributed only to the ReactionAttributed registered for its subtype,
+	/// so what an event costs grows with the reactions that match it instead of with every reaction alive.
+	/// Subtypes are keyed by their interned Symbol. The dispatcher subscribes to the event type on behalf of all reactions,
+	/// when a reaction registers and it is not subscribed (also after Event&lt;EventMessageAttributed&gt;::UnsubscribeAll),
+	/// and unsubscribes when the last one leaves.
+	/// A reaction registers under the subtype it has when it is made, usually none; the parser and ScopeCooker sync it once they
+	/// have written its SubType datum. A subtype written through the datum otherwise is picked up on the reaction's next Update,
+	/// or when an event of its old subtype comes by.
+	/// Safe to use from multiple threads; reactions may create and destroy other reactions while they react.
+	/// Unregistering waits for the dispatches in progress on other threads, which may still hold the reaction.
+	/// </summary>
+	class ReactionDispatcher final : public IEventSubscriber
+	{
+	public:
+		ReactionDispatcher(const ReactionDispatcher& rhs) = delete;
+		ReactionDispatcher(ReactionDispatcher&& rhs) = delete;
+		ReactionDispatcher& operator=(const ReactionDispatcher& rhs) = delete;
+		ReactionDispatcher& operator=(ReactionDispatcher&& rhs) = delete;
+		~ReactionDispatcher() = default;
+
+		/// <summary>
+		/// Routes events of the reaction's current subtype to it from now on
+		/// </summary>
+		/// <param name="reaction">reaction to register, not owned</param>
+		static void Register(ReactionAttributed& reaction);
+		/// <summary>
+		/// Stops routing events to the reaction and waits for the dispatches in progress that may still hand it one,
+		/// so it can be destroyed once this returns. Called from inside a dispatch it does not wait, the reaction is
+		/// only taken out of the dispatches on this thread
+		/// </summary>
+		/// <param name="reaction">registered reaction</param>
+		static void Unregister(ReactionAttributed& reaction);
+		/// <summary>
+		/// Moves a reaction over to its current subtype if that is not the one it is registered for
+		/// </summary>
+		/// <param name="reaction">registered reaction</param>
+		static void Sync(ReactionAttributed& reaction);
+		/// <summary>
+		/// Syncs a scope a loader has written the attributes of, if it is a ReactionAttributed
+		/// </summary>
+		/// <param name="scope">loaded scope</param>
+		static void SyncLoaded(Scope& scope);
+		/// <summary>
+		/// Gets the number of reactions registered for a subtype
+		/// </summary>
+		/// <param name="subtype">subtype</param>
+		/// <returns>size_t</returns>
+		static std::size_t ReactionCount(const std::string& subtype);
+
+		/// <summary>
+		/// Hands the event to the reactions registered for its subtype
+		/// </summary>
+		/// <param name="event">Event of EventMessageAttributed</param>
+		virtual void Notify(const IEventPublisher& event) override;
+		/// <summary>
+		/// Hands each event of the batch to the reactions registered for its subtype, in order
+		/// </summary>
+		/// <param name="events">Events of EventMessageAttributed</param>
+		/// <param name="count">number of events</param>
+		virtual void NotifyBatch(const IEventPublisher* const* events, std::size_t count) override;
+
+	private:
+		ReactionDispatcher() = default;
+
+		/// <summary>
+		/// Takes the reaction out of its subtype's list, dropping the list once it is empty. Expects the lock held.
+		/// </summary>
+		static void Erase(ReactionAttributed& reaction, const Symbol& subtype);
+		/// <summary>
+		/// Moves the reaction over to its current subtype if it changed. Expects the lock held.
+		/// </summary>
+		static void Move(ReactionAttributed& reaction);
+		/// <summary>
+		/// Waits until the dispatches in progress have finished, unless this thread is running one
+		/// </summary>
+		static void WaitForReaders();
+
+		using TableType = Hashmap<Symbol, Vector<ReactionAttributed*>>;
+
+		static ReactionDispatcher mInstance;
+		static TableType mReactionTable;
+		static std::shared_mutex mMutex;
+
+		// dispatches in progress counted per phase, so an unregister only waits for the ones that started before it
+		static std::atomic<std::size_t> mPhase;
+		static std::atomic<std::size_t> mReaders[2];
+		static std::mutex mGraceMutex;
+	};
+}
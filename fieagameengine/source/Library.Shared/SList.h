@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DefaultEquality.h"
+#include "Memory.h"
 
 namespace Library
 {
@@ -26,6 +27,12 @@ namespace Library
 
 			Node(const T& data, Node* next = nullptr);
 			Node(T&& data, Node* next = nullptr);
+
+			/// <summary>
+			/// Nodes go through Memory, so a list filled while an Arena is current keeps its nodes in the arena
+			/// </summary>
+			static void* operator new(std::size_t size);
+			static void operator delete(void* data);
 		};
 
 	public:
@@ -256,6 +263,13 @@ namespace Library
 		/// </summary>
 		void PopFront();
 
+		/// <summary>
+		/// unlinks the first node of the other list and links it in as the front of this list.
+		/// Nothing is allocated or copied, so pointers/references to the moved item stay valid
+		/// </summary>
+		/// <param name="other">list to take the front node from, cannot be empty</param>
+		void SpliceFront(SList& other);
+
 		/// <summary>
 		///  remove the last item from the list and destructs the item deleted
 		/// </summary>
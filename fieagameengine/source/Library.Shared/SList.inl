@@ -18,6 +18,18 @@ namespace Library
 	{
 	}
 
+	template<typename T>
+	inline void* SList<T>::Node::operator new(std::size_t size)
+	{
+		return Memory::Allocate(size);
+	}
+
+	template<typename T>
+	inline void SList<T>::Node::operator delete(void* data)
+	{
+		Memory::Free(data);
+	}
+
 #pragma endregion Node
 
 #pragma region Iterator
@@ -327,6 +339,34 @@ namespace Library
 		}
 	}
 
+	template<typename T>
+	inline void SList<T>::SpliceFront(SList& other)
+	{
+		if (other.IsEmpty())
+		{
+			throw std::runtime_error("List is empty.");
+		}
+
+		Node* node = other.mFront;
+		other.mFront = node->Next;
+		other.mSize--;
+
+		if (other.mSize <= 1)
+		{
+			other.mBack = other.mFront;
+		}
+
+		node->Next = mFront;
+		mFront = node;
+
+		if (IsEmpty())
+		{
+			mBack = mFront;
+		}
+
+		mSize++;
+	}
+
 	template<typename T>
 	inline void SList<T>::PopBack()
 	{
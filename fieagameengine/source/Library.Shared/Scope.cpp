@@ -15,7 +15,7 @@ namespace Library
 	{
 		for (const auto entry : rhs.mOrderedVector)
 		{
-			const std::string& key = entry->first;
+			const Symbol& key = entry->first;
 			const Datum& existingDatum = entry->second;
 			Datum& newDatum = Append(key);
 
@@ -59,7 +59,7 @@ namespace Library
 
 			for (const auto entry : rhs.mOrderedVector)
 			{
-				const std::string& key = entry->first;
+				const Symbol& key = entry->first;
 				const Datum& existingDatum = entry->second;
 				Datum& newDatum = Append(key);
 
@@ -108,6 +108,25 @@ namespace Library
 		Clear();
 	}
 
+	void* Scope::operator new(std::size_t size)
+	{
+		return Memory::Allocate(size);
+	}
+
+	void* Scope::operator new(std::size_t /*size*/, void* place) noexcept
+	{
+		return place;
+	}
+
+	void Scope::operator delete(void* data)
+	{
+		Memory::Free(data);
+	}
+
+	void Scope::operator delete(void* /*data*/, void* /*place*/) noexcept
+	{
+	}
+
 	void Scope::Clear()
 	{
 		for (size_t i = 0; i < mOrderedVector.Size(); ++i)
@@ -184,12 +203,28 @@ namespace Library
 		return Append(key);
 	}
 
+	Datum& Scope::operator[](const Symbol& key)
+	{
+		return Append(key);
+	}
+
 	Datum* Scope::Find(const std::string& key)
 	{
-		return const_cast<Datum*>(FindHelper(key));
+		// a string that was never interned cannot be a key in any scope
+		return Find(Symbol::TryFind(key));
 	}
 
 	const Datum* Scope::Find(const std::string& key) const
+	{
+		return Find(Symbol::TryFind(key));
+	}
+
+	Datum* Scope::Find(const Symbol& key)
+	{
+		return const_cast<Datum*>(FindHelper(key));
+	}
+
+	const Datum* Scope::Find(const Symbol& key) const
 	{
 		return FindHelper(key);
 	}
@@ -219,20 +254,40 @@ namespace Library
 
 	Datum* Scope::Search(const std::string& key)
 	{
-		return const_cast<Datum*>(SearchHelper(key));
+		return const_cast<Datum*>(SearchHelper(Symbol::TryFind(key)));
 	}
 
 	const Datum* Scope::Search(const std::string& key) const
 	{
-		return SearchHelper(key);
+		return SearchHelper(Symbol::TryFind(key));
 	}
 
 	Datum* Scope::Search(const std::string& key, Scope*& foundScope)
 	{
-		return const_cast<Datum*>(SearchHelper(key, &foundScope));
+		return const_cast<Datum*>(SearchHelper(Symbol::TryFind(key), &foundScope));
 	}
 
 	const Datum* Scope::Search(const std::string& key, Scope*& foundScope) const
+	{
+		return SearchHelper(Symbol::TryFind(key), &foundScope);
+	}
+
+	Datum* Scope::Search(const Symbol& key)
+	{
+		return const_cast<Datum*>(SearchHelper(key));
+	}
+
+	const Datum* Scope::Search(const Symbol& key) const
+	{
+		return SearchHelper(key);
+	}
+
+	Datum* Scope::Search(const Symbol& key, Scope*& foundScope)
+	{
+		return const_cast<Datum*>(SearchHelper(key, &foundScope));
+	}
+
+	const Datum* Scope::Search(const Symbol& key, Scope*& foundScope) const
 	{
 		return SearchHelper(key, &foundScope);
 	}
@@ -243,6 +298,21 @@ namespace Library
 
 	Datum& Scope::Append(const std::string& key)
 	{
+		return Append(Symbol::Intern(key));
+	}
+
+	Datum& Scope::Append(const std::string& key, const Datum& datum)
+	{
+		return Append(Symbol::Intern(key), datum);
+	}
+
+	Datum& Scope::Append(const Symbol& key)
+	{
+		if (!key.IsValid())
+		{
+			throw std::runtime_error("Invalid Symbol: key was never interned.");
+		}
+
 		auto [it, isAppended] = mHashTable.Insert({ key , Datum() });
 
 		if (isAppended)
@@ -253,8 +323,13 @@ namespace Library
 		return it->second;
 	}
 
-	Datum& Scope::Append(const std::string& key, const Datum& datum)
+	Datum& Scope::Append(const Symbol& key, const Datum& datum)
 	{
+		if (!key.IsValid())
+		{
+			throw std::runtime_error("Invalid Symbol: key was never interned.");
+		}
+
 		auto [it, isAppended] = mHashTable.Insert({ key , datum });
 
 		if (isAppended)
@@ -266,6 +341,11 @@ namespace Library
 	}
 	
 	Scope& Scope::AppendScope(const std::string& key)
+	{
+		return AppendScope(Symbol::Intern(key));
+	}
+
+	Scope& Scope::AppendScope(const Symbol& key)
 	{
 		Datum& datum = Append(key);
 		datum.SetType(Datum::DatumTypes::Table);
@@ -288,6 +368,16 @@ namespace Library
 
 	void Scope::Adopt(Scope& child, const std::string& key)
 	{
+		Adopt(child, Symbol::Intern(key));
+	}
+
+	void Scope::Adopt(Scope& child, const Symbol& key)
+	{
+		if (!key.IsValid())
+		{
+			throw std::runtime_error("Invalid Symbol: key was never interned.");
+		}
+
 		auto [it, isAppended] = mHashTable.Insert({ key , Datum() });
 		Datum& datum = it->second;
 
@@ -316,7 +406,7 @@ namespace Library
 		return mParent;
 	}
 
-	const Datum* Scope::FindHelper(const std::string& key) const
+	const Datum* Scope::FindHelper(const Symbol& key) const
 	{
 		auto it = mHashTable.Find(key);
 		if (it != mHashTable.end())
@@ -327,7 +417,7 @@ namespace Library
 		return nullptr;
 	}
 
-	const Datum* Scope::SearchHelper(const std::string& key, Scope** foundScope) const
+	const Datum* Scope::SearchHelper(const Symbol& key, Scope** foundScope) const
 	{
 		if(foundScope != nullptr) *foundScope = const_cast<Scope*>(this);
 
@@ -341,6 +431,18 @@ namespace Library
 		return found;
 	}
 
+	void Scope::CopyLayout(const Scope& prototype)
+	{
+		assert(mOrderedVector.IsEmpty());
+
+		mHashTable = prototype.mHashTable;
+		mOrderedVector.Reserve(prototype.mOrderedVector.Size());
+		for (const auto entry : prototype.mOrderedVector)
+		{
+			mOrderedVector.PushBack(&(*mHashTable.Find(entry->first)));
+		}
+	}
+
 #pragma endregion Helpers:
 
 
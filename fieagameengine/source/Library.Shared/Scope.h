@@ -3,7 +3,9 @@
 #include "RTTI.h"
 #include "vector.h"
 #include "hashmap.h"
+#include "FlatHashmap.h"
 #include "Datum.h"
+#include "Symbol.h"
 #include <gsl/gsl>
 
 namespace Library
@@ -11,9 +13,19 @@ namespace Library
 	class Scope : public Library::RTTI
 	{
 		RTTI_DECLARATIONS(Scope, Library::RTTI)		
+		// read the ordered attributes when cooking and when merging loaded files
+		friend class ScopeCooker;
+		friend class JsonParallelLoader;
+		friend class JsonTableParseHelper;
+		friend class World;
 
 	public:
-		using HashTable = Hashmap<std::string, Datum>;
+		// the DebugFlatScope configuration builds the library and the tests with the open-addressing table
+#ifdef FIEA_SCOPE_FLAT_HASHMAP
+		using HashTable = FlatHashmap<Symbol, Datum>;
+#else
+		using HashTable = Hashmap<Symbol, Datum>;
+#endif
 		using HashTablePair = HashTable::PairType;
 		using OrderedVector = Vector<HashTablePair*>;
 
@@ -51,6 +63,15 @@ namespace Library
 		/// </summary>
 		virtual ~Scope();
 
+		/// <summary>
+		/// Scopes (and everything derived from them) are allocated through Memory,
+		/// so a tree built while an Arena is current keeps its nodes in the arena
+		/// </summary>
+		static void* operator new(std::size_t size);
+		static void* operator new(std::size_t size, void* place) noexcept;
+		static void operator delete(void* data);
+		static void operator delete(void* data, void* place) noexcept;
+
 	#pragma endregion Constructors, Assignments & Destructor:
 
 	#pragma region Equality:
@@ -95,15 +116,22 @@ namespace Library
 		Datum& operator [] (const std::string& key);
 
 		const Datum& operator[](const std::string& key) const;
+		/// <summary>
+		/// Symbol version of operator [], wraps Append
+		/// </summary>
+		/// <param name="key">interned key</param>
+		/// <returns>Datum reference</returns>
+		Datum& operator [] (const Symbol& key);
 
 		/// <summary>
 		/// which takes a constant string and returns the address of a Datum. 
 		/// This should return the address of the Datum associated with the given name in this Scope, 
 		/// if it exists, and nullptr otherwise.
+		/// Looks the string up with Symbol::TryFind and forwards to the Symbol version.
 		/// </summary>
 		/// <param name="key">constant string key</param>
 		/// <returns>return the address of the Datum if exists, otherwise nullptr</returns>
-		virtual Datum* Find(const std::string& key);
+		Datum* Find(const std::string& key);
 		/// <summary>
 		/// which takes a constant string and returns the address of a Datum. 
 		/// This should return the address of the Datum associated with the given name in this Scope, 
@@ -111,7 +139,19 @@ namespace Library
 		/// </summary>
 		/// <param name="key">constant string key</param>
 		/// <returns>return the const address of the Datum if exists, otherwise nullptr</returns>
-		virtual const Datum* Find(const std::string& key) const;
+		const Datum* Find(const std::string& key) const;
+		/// <summary>
+		/// Symbol version of Find, an integer hash and id compare. Derived scopes override this one
+		/// </summary>
+		/// <param name="key">interned key</param>
+		/// <returns>return the address of the Datum if exists, otherwise nullptr</returns>
+		virtual Datum* Find(const Symbol& key);
+		/// <summary>
+		/// Symbol version of Find, an integer hash and id compare
+		/// </summary>
+		/// <param name="key">interned key</param>
+		/// <returns>return the const address of the Datum if exists, otherwise nullptr</returns>
+		virtual const Datum* Find(const Symbol& key) const;
 
 		/// <summary>
 		/// which takes the constant address of a Scope and returns the Datum pointer and index at which the Scope was found.
@@ -160,6 +200,15 @@ namespace Library
 		/// <param name="key">constant string key</param>
 		/// <returns>returns the const address of a Datum</returns>
 		const Datum* Search(const std::string& key, Scope*& foundScope) const;
+		/// <summary>
+		/// Symbol versions of Search
+		/// </summary>
+		/// <param name="key">interned key</param>
+		/// <returns>returns the address of a Datum</returns>
+		Datum* Search(const Symbol& key);
+		const Datum* Search(const Symbol& key) const;
+		Datum* Search(const Symbol& key, Scope*& foundScope);
+		const Datum* Search(const Symbol& key, Scope*& foundScope) const;
 
 		/// <summary>
 		/// Return a bool indicating whether the list contains any items
@@ -192,6 +241,13 @@ namespace Library
 		Datum& Append(const std::string& key);
 		Datum& Append(const std::string& key, const Datum& datum);
 		/// <summary>
+		/// Symbol versions of Append, the string versions intern the key and forward here
+		/// </summary>
+		/// <param name="key">interned key, needs to be valid</param>
+		/// <returns>return a reference to a Datum with the associated name</returns>
+		Datum& Append(const Symbol& key);
+		Datum& Append(const Symbol& key, const Datum& datum);
+		/// <summary>
 		/// This should return a reference to a Scope with the associated name.  
 		/// If a Datum already exists at that key reuse it (and append to it a new Scope), 
 		/// otherwise create a new Datum. 
@@ -202,6 +258,7 @@ namespace Library
 		/// <param name="key">constant string key</param>
 		/// <returns>returns a reference to Scope.</returns>
 		Scope& AppendScope(const std::string& key);
+		Scope& AppendScope(const Symbol& key);
 
 		/// <summary>
 		/// which takes a reference to a Scope (the child to adopt), 
@@ -210,6 +267,7 @@ namespace Library
 		/// <param name="child">reference to a Scope</param>
 		/// <param name="key">a string </param>
 		void Adopt(Scope& child, const std::string& key);
+		void Adopt(Scope& child, const Symbol& key);
 		/// <summary>
 		///  which returns the address of the Scope which contains this one
 		/// </summary>
@@ -232,17 +290,17 @@ namespace Library
 		/// <summary>
 		/// Helper method to Find a pair using the given key, locally
 		/// </summary>
-		/// <param name="key">std::string key used to find</param>
+		/// <param name="key">interned key used to find</param>
 		/// <returns>Pointer to Datum if found, nullptr if not found</returns>
-		const Datum* FindHelper(const std::string& key) const;
+		const Datum* FindHelper(const Symbol& key) const;
 		/// <summary>
 		/// Helper Seacrch to look for Pair with key, hierarchically upwards
 		/// also returns the scope that closest that contains key
 		/// </summary>
-		/// <param name="key">std::string key used to search</param>
+		/// <param name="key">interned key used to search</param>
 		/// <param name="foundScope">Scope*& of the scope</param>
 		/// <returns>Pointer to Datum if found, nullptr if not found</returns>
-		const Datum* SearchHelper(const std::string& key, Scope** foundScope = nullptr) const;
+		const Datum* SearchHelper(const Symbol& key, Scope** foundScope = nullptr) const;
 				
 	#pragma endregion Helpers:
 	public:
@@ -255,6 +313,14 @@ namespace Library
 	protected:
 		const OrderedVector& GetOrderedVector() const;
 
+		/// <summary>
+		/// Gives an empty scope the attributes of a prototype in one go: the hash table is copied whole
+		/// and the ordered vector pointed at the copy, instead of appending the attributes one by one.
+		/// The prototype's datums are copied as they are, so it should hold no child scopes
+		/// </summary>
+		/// <param name="prototype">scope whose attributes to copy</param>
+		void CopyLayout(const Scope& prototype);
+
 
 	private:
 
@@ -262,6 +328,9 @@ namespace Library
 
 		OrderedVector mOrderedVector;
 		HashTable mHashTable;
+
+		// set by World::Bury while the scope waits in the graveyard, copies and moves do not carry it over
+		bool mIsBuried{ false };
 	};
 }
 
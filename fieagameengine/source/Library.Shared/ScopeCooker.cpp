@@ -0,0 +1,437 @@
+#include "pch.h"
+#include "ScopeCooker.h"
+#include "Arena.h"
+#include "Factory.h"
+#include "MappedFile.h"
+#include "ReactionDispatcher.h"
+#include <cstring>
+#include <fstream>
+
+namespace Library
+{
+	/// <summary>
+	/// Builds the tables while the tree is written to a body buffer, the tables go out first once they are complete
+	/// </summary>
+	class ScopeCooker::Writer final
+	{
+	public:
+		void Write(const Scope& scope)
+		{
+			const Scope::OrderedVector& attributes = Attributes(scope);
+			Put(static_cast<std::uint32_t>(attributes.Size()));
+
+			for (const Scope::HashTablePair* pair : attributes)
+			{
+				const Datum& datum = pair->second;
+				const std::uint32_t size = static_cast<std::uint32_t>(datum.Size());
+				Put(SymbolIndex(pair->first));
+				Put(static_cast<std::uint8_t>(datum.Type()));
+
+				switch (datum.Type())
+				{
+				case Datum::DatumTypes::Integer:
+					PutValues<std::int32_t>(datum);
+					break;
+				case Datum::DatumTypes::Float:
+					PutValues<std::float_t>(datum);
+					break;
+				case Datum::DatumTypes::Vector:
+					PutValues<glm::vec4>(datum);
+					break;
+				case Datum::DatumTypes::Matrix:
+					PutValues<glm::mat4>(datum);
+					break;
+				case Datum::DatumTypes::String:
+					Put(size);
+					for (std::uint32_t i = 0; i < size; ++i)
+					{
+						Put(StringIndex(datum.Get<std::string>(i)));
+					}
+					break;
+				case Datum::DatumTypes::Table:
+				{
+					// only children the scope owns, a table can also refer to a scope elsewhere (like an Attributed's "this")
+					std::uint32_t ownedCount = 0;
+					for (std::uint32_t i = 0; i < size; ++i)
+					{
+						ownedCount += (datum[i].GetParent() == &scope ? 1 : 0);
+					}
+
+					Put(ownedCount);
+					for (std::uint32_t i = 0; i < size; ++i)
+					{
+						const Scope& child = datum[i];
+						if (child.GetParent() == &scope)
+						{
+							Put(ClassIndex(child));
+							Write(child);
+						}
+					}
+					break;
+				}
+				default:
+					// pointers only make sense in the running game
+					Put(std::uint32_t(0));
+					break;
+				}
+			}
+		}
+
+		void Flush(std::ostream& output) const
+		{
+			PutRaw(output, ScopeCooker::Magic);
+			PutRaw(output, ScopeCooker::Version);
+			PutTable(output, mSymbols);
+			PutTable(output, mStrings);
+			output.write(mBody.data(), mBody.size());
+
+			if (!output.good())
+			{
+				throw std::runtime_error("Could not write cooked data");
+			}
+		}
+
+	private:
+		template <typename T>
+		void Put(const T& value)
+		{
+			mBody.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		template <typename T>
+		void PutValues(const Datum& datum)
+		{
+			const std::size_t size = datum.Size();
+			Put(static_cast<std::uint32_t>(size));
+			if (size > 0)
+			{
+				mBody.append(reinterpret_cast<const char*>(&datum.Get<T>(0)), size * sizeof(T));
+			}
+		}
+
+		template <typename T>
+		static void PutRaw(std::ostream& output, const T& value)
+		{
+			output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		static void PutTable(std::ostream& output, const Vector<std::string>& table)
+		{
+			PutRaw(output, static_cast<std::uint32_t>(table.Size()));
+			for (const std::string& entry : table)
+			{
+				PutRaw(output, static_cast<std::uint32_t>(entry.size()));
+				output.write(entry.data(), entry.size());
+			}
+		}
+
+		std::uint32_t SymbolIndex(const Symbol& key)
+		{
+			auto [it, isInserted] = mSymbolIndices.Insert(std::make_pair(key.Id(), static_cast<std::uint32_t>(mSymbols.Size())));
+			if (isInserted)
+			{
+				mSymbols.PushBack(std::string(key.Name()));
+			}
+			return (*it).second;
+		}
+
+		std::uint32_t StringIndex(const std::string& string)
+		{
+			auto [it, isInserted] = mStringIndices.Insert(std::make_pair(string, static_cast<std::uint32_t>(mStrings.Size())));
+			if (isInserted)
+			{
+				mStrings.PushBack(string);
+			}
+			return (*it).second;
+		}
+
+		std::uint32_t ClassIndex(const Scope& scope)
+		{
+			if (scope.TypeIdInstance() == Scope::TypeIdClass())
+			{
+				return ScopeCooker::NoClass;
+			}
+
+			const std::string className = Factory<Scope>::ClassNameOf(scope);
+			if (className.empty())
+			{
+				throw std::runtime_error("No Factory<Scope> creates the type of a scope being cooked");
+			}
+			return StringIndex(className);
+		}
+
+		std::string mBody;
+		Hashmap<std::size_t, std::uint32_t> mSymbolIndices;
+		Vector<std::string> mSymbols;
+		Hashmap<const std::string, std::uint32_t> mStringIndices;
+		Vector<std::string> mStrings;
+	};
+
+	/// <summary>
+	/// Walks an image in place, the tables become views into it and symbols interned once each
+	/// </summary>
+	class ScopeCooker::Reader final
+	{
+	public:
+		Reader(std::string_view image, Arena* arena) :
+			mCursor(image.data()), mEnd(image.data() + image.size()), mArena(arena)
+		{
+			if (Get<std::uint32_t>() != ScopeCooker::Magic)
+			{
+				throw std::runtime_error("Not a cooked scope image");
+			}
+			if (Get<std::uint32_t>() != ScopeCooker::Version)
+			{
+				throw std::runtime_error("Cooked scope image has an unsupported version");
+			}
+
+			const std::uint32_t symbolCount = Get<std::uint32_t>();
+			mSymbols.Reserve(symbolCount);
+			for (std::uint32_t i = 0; i < symbolCount; ++i)
+			{
+				mSymbols.PushBack(Symbol::Intern(std::string(TakeString())));
+			}
+
+			const std::uint32_t stringCount = Get<std::uint32_t>();
+			mStrings.Reserve(stringCount);
+			for (std::uint32_t i = 0; i < stringCount; ++i)
+			{
+				mStrings.PushBack(TakeString());
+			}
+		}
+
+		/// <summary>
+		/// Reads the attributes of a scope
+		/// </summary>
+		/// <param name="scope">scope to fill in</param>
+		/// <param name="arena">arena the scope's own attributes go in, nullptr for the heap</param>
+		void Read(Scope& scope, Arena* arena)
+		{
+			const std::uint32_t attributeCount = Get<std::uint32_t>();
+			for (std::uint32_t attribute = 0; attribute < attributeCount; ++attribute)
+			{
+				const Symbol& key = Entry(mSymbols, Get<std::uint32_t>());
+				const std::uint8_t type = Get<std::uint8_t>();
+				const std::uint32_t size = Get<std::uint32_t>();
+				if (type >= static_cast<std::uint8_t>(Datum::DatumTypes::Max))
+				{
+					throw std::runtime_error("Cooked scope image has a bad datum type");
+				}
+
+				const Datum::DatumTypes datumType = static_cast<Datum::DatumTypes>(type);
+				Datum* datum;
+				{
+					Arena::Guard guard(arena);
+					datum = &scope.Append(key);
+				}
+				if (datum->Type() == Datum::DatumTypes::Unknown)
+				{
+					datum->SetType(datumType);
+				}
+				else if (datum->Type() != datumType)
+				{
+					throw std::runtime_error("Cooked datum type does not match the scope's");
+				}
+
+				if (datumType == Datum::DatumTypes::Table)
+				{
+					ReadChildren(scope, key, *datum, size, arena);
+				}
+				else
+				{
+					Arena::Guard guard(arena);
+					ReadValues(*datum, size);
+				}
+			}
+
+			// a reaction is routed by the subtype it was loaded with from the next event on
+			ReactionDispatcher::SyncLoaded(scope);
+		}
+
+		/// <summary>
+		/// Reads the children of a table attribute. A new plain child and the attributes of any new child go in the arena,
+		/// scopes of a class are made by their factory on the heap: a constructor can register its product with things that outlive the load
+		/// </summary>
+		/// <param name="scope">scope holding the attribute</param>
+		/// <param name="key">name of the attribute</param>
+		/// <param name="datum">the attribute</param>
+		/// <param name="size">number of children in the image</param>
+		/// <param name="arena">arena the scope's own attributes go in, nullptr for the heap</param>
+		void ReadChildren(Scope& scope, const Symbol& key, Datum& datum, std::uint32_t size, Arena* arena)
+		{
+			for (std::uint32_t i = 0; i < size; ++i)
+			{
+				const std::uint32_t classIndex = Get<std::uint32_t>();
+				if (datum.Size() > i)
+				{
+					Read(datum[i], arena);
+					continue;
+				}
+
+				Scope* child;
+				if (classIndex != ScopeCooker::NoClass)
+				{
+					child = Factory<Scope>::Create(std::string(Entry(mStrings, classIndex)));
+				}
+				else
+				{
+					Arena::Guard guard(mArena);
+					child = new Scope();
+				}
+
+				{
+					// the datum holding the child grows where its scope's attributes live
+					Arena::Guard guard(arena);
+					scope.Adopt(*child, key);
+				}
+				Read(*child, mArena);
+			}
+		}
+
+		/// <summary>
+		/// Reads the values of an attribute that is not a table
+		/// </summary>
+		/// <param name="datum">the attribute</param>
+		/// <param name="size">number of values in the image</param>
+		void ReadValues(Datum& datum, std::uint32_t size)
+		{
+			switch (datum.Type())
+			{
+			case Datum::DatumTypes::Integer:
+				TakeValues<std::int32_t>(datum, size);
+				break;
+			case Datum::DatumTypes::Float:
+				TakeValues<std::float_t>(datum, size);
+				break;
+			case Datum::DatumTypes::Vector:
+				TakeValues<glm::vec4>(datum, size);
+				break;
+			case Datum::DatumTypes::Matrix:
+				TakeValues<glm::mat4>(datum, size);
+				break;
+			case Datum::DatumTypes::String:
+				for (std::uint32_t i = 0; i < size; ++i)
+				{
+					datum.Set(std::string(Entry(mStrings, Get<std::uint32_t>())), i);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		bool IsAtEnd() const
+		{
+			return mCursor == mEnd;
+		}
+
+	private:
+		template <typename T>
+		T Get()
+		{
+			T value;
+			Take(&value, sizeof(T));
+			return value;
+		}
+
+		void Take(void* data, std::size_t size)
+		{
+			if (size > static_cast<std::size_t>(mEnd - mCursor))
+			{
+				throw std::runtime_error("Cooked scope image is truncated");
+			}
+			std::memcpy(data, mCursor, size);
+			mCursor += size;
+		}
+
+		std::string_view TakeString()
+		{
+			const std::uint32_t length = Get<std::uint32_t>();
+			if (length > static_cast<std::size_t>(mEnd - mCursor))
+			{
+				throw std::runtime_error("Cooked scope image is truncated");
+			}
+			const std::string_view string(mCursor, length);
+			mCursor += length;
+			return string;
+		}
+
+		template <typename T>
+		void TakeValues(Datum& datum, std::uint32_t size)
+		{
+			if (datum.IsExternal())
+			{
+				if (datum.Size() != size)
+				{
+					throw std::runtime_error("Cooked datum size does not match its external storage");
+				}
+			}
+			else
+			{
+				datum.Resize(size);
+			}
+
+			// the values are stored the way the datum holds them, one copy for the whole array
+			if (size > 0)
+			{
+				Take(&datum.Get<T>(0), size * sizeof(T));
+			}
+		}
+
+		template <typename T>
+		static const T& Entry(const Vector<T>& table, std::uint32_t index)
+		{
+			if (index >= table.Size())
+			{
+				throw std::runtime_error("Cooked scope image has a bad table index");
+			}
+			return table[index];
+		}
+
+		const char* mCursor;
+		const char* mEnd;
+		Arena* mArena;
+		Vector<Symbol> mSymbols;
+		Vector<std::string_view> mStrings;
+	};
+
+	void ScopeCooker::Cook(const Scope& scope, std::ostream& output)
+	{
+		Writer writer;
+		writer.Write(scope);
+		writer.Flush(output);
+	}
+
+	void ScopeCooker::CookToFile(const Scope& scope, const std::string& fileName)
+	{
+		std::ofstream file(fileName, std::ios::binary);
+		if (!file.good())
+		{
+			throw std::runtime_error("Bad File");
+		}
+
+		Cook(scope, file);
+	}
+
+	void ScopeCooker::Load(std::string_view image, Scope& root, Arena* arena)
+	{
+		Reader reader(image, arena);
+		reader.Read(root, nullptr);
+
+		if (!reader.IsAtEnd())
+		{
+			throw std::runtime_error("Unexpected data after the cooked scope");
+		}
+	}
+
+	void ScopeCooker::LoadFromFile(const std::string& fileName, Scope& root, Arena* arena)
+	{
+		const MappedFile file(fileName);
+		Load(file.Contents(), root, arena);
+	}
+
+	const Scope::OrderedVector& ScopeCooker::Attributes(const Scope& scope)
+	{
+		return scope.GetOrderedVector();
+	}
+}
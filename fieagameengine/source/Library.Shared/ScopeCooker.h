@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "Scope.h"
+
+namespace Library
+{
+	class Arena;
+
+	/// <summary>
+	/// Offline "cook" of a loaded Scope tree into a compact binary image, and the loader that rebuilds a tree from it.
+	/// The image holds a table of attribute keys, a table of strings (string values and class names) and the tree in
+	/// preorder. Every datum is its key index, type, size and values; numbers, vectors and matrices are stored raw and
+	/// loaded with one copy per datum, strings are indices into the table, nested scopes carry the index of the class
+	/// name their factory is registered by. Pointers and tables referring to scopes the tree does not own (like "this")
+	/// are runtime state: only their type is kept. The image uses the byte order and float layout of the machine that cooked it.
+	/// </summary>
+	class ScopeCooker final
+	{
+	public:
+		ScopeCooker() = delete;
+
+		/// <summary>
+		/// (static) Writes the attributes of a scope and everything under it.
+		/// Throws if a nested scope has a type no Factory&lt;Scope&gt; creates
+		/// </summary>
+		/// <param name="scope">root of the tree, its own type is not recorded</param>
+		/// <param name="output">binary stream to write to</param>
+		static void Cook(const Scope& scope, std::ostream& output);
+		/// <summary>
+		/// (static) Cooks a scope into a file
+		/// </summary>
+		/// <param name="scope">root of the tree</param>
+		/// <param name="fileName">path of the file, overwritten</param>
+		static void CookToFile(const Scope& scope, const std::string& fileName);
+
+		/// <summary>
+		/// (static) Rebuilds a cooked tree under root, the way JsonParseMaster would with a JsonTableParseHelper:
+		/// attributes root already has (prescribed ones) are filled in, the others are appended,
+		/// and nested scopes with a class are made by Factory&lt;Scope&gt;. Throws if the image is malformed
+		/// </summary>
+		/// <param name="image">cooked image</param>
+		/// <param name="root">scope to load into, usually of the type that was cooked</param>
+		/// <param name="arena">arena for the attributes of the nested scopes the load creates and for the plain ones themselves, nullptr for the heap.
+		/// Scopes of a class are made by their factory on the heap and root's own attributes stay where they are.
+		/// The new scopes are root's children so the arena has to outlive root</param>
+		static void Load(std::string_view image, Scope& root, Arena* arena = nullptr);
+		/// <summary>
+		/// (static) Maps a cooked file into memory and loads it
+		/// </summary>
+		/// <param name="fileName">path of the file</param>
+		/// <param name="root">scope to load into</param>
+		/// <param name="arena">arena for what the load creates under root, nullptr for the heap</param>
+		static void LoadFromFile(const std::string& fileName, Scope& root, Arena* arena = nullptr);
+
+		static constexpr std::uint32_t Magic = 0x4B4F4F43; // "COOK"
+		static constexpr std::uint32_t Version = 1;
+		static constexpr std::uint32_t NoClass = UINT32_MAX;
+
+	private:
+		class Writer;
+		class Reader;
+
+		static const Scope::OrderedVector& Attributes(const Scope& scope);
+	};
+}
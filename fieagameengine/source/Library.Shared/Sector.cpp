@@ -51,7 +51,7 @@ namespace Library
 
 	World* Sector::GetWorld() const
 	{
-		assert(GetParent()->Is(World::TypeIdClass()));
+		assert(GetParent()->Is<World>());
 		return static_cast<World*>(GetParent());
 	}
 
@@ -76,7 +76,7 @@ namespace Library
 		for (std::size_t i = 0; i < entities.Size(); ++i)
 		{
 			Scope& entityScope = entities[i];
-			assert(entityScope.Is(Entity::TypeIdClass()));
+			assert(entityScope.Is<Entity>());
 
 			Entity& entity = static_cast<Entity&>(entityScope);
 			worldState.entity = &entity;
@@ -1,10 +1,16 @@
 #pragma once
 #include "Datum.h"
+#include <limits>
 
 namespace Library
 {
 	struct Signature final
 	{
+		/// <summary>
+		/// Offset of a signature with no member behind it, its values live in the type's AttributePool
+		/// </summary>
+		static constexpr std::size_t Pooled = std::numeric_limits<std::size_t>::max();
+
 		std::string mName;
 		Datum::DatumTypes mType;
 		std::size_t mSize;
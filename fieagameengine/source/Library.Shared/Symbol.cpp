@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "Symbol.h"
+#include "Memory.h"
+#include <cstring>
+#include <mutex>
+
+namespace Library
+{
+	namespace
+	{
+		// the block interned characters are being copied into, only touched under the table's unique lock
+		char* sCharacters{ nullptr };
+		std::size_t sCharactersLeft{ 0 };
+	}
+
+	Symbol::Symbol(const std::string& name) :
+		Symbol(Intern(name))
+	{
+	}
+
+	Symbol::Symbol(const char* name) :
+		Symbol(Intern(std::string(name)))
+	{
+	}
+
+	Symbol Symbol::Intern(const std::string& name)
+	{
+		TableType& table = Table();
+
+		{
+			std::shared_lock<std::shared_mutex> lock(TableMutex());
+			auto it = table.Find(name);
+			if (it != table.end())
+			{
+				return Symbol(it->first, it->second);
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> lock(TableMutex());
+
+		// another thread may have interned it between the two locks
+		auto it = table.Find(name);
+		if (it == table.end())
+		{
+			// interned strings live until the program exits, the table's memory stays out of leak checks (on this thread only) and out of any arena
+			Memory::UntrackedGuard untracked;
+			it = std::get<0>(table.Insert({ Store(name), table.Size() + 1 }));
+		}
+		return Symbol(it->first, it->second);
+	}
+
+	Symbol Symbol::TryFind(const std::string& name)
+	{
+		TableType& table = Table();
+
+		std::shared_lock<std::shared_mutex> lock(TableMutex());
+		auto it = table.Find(name);
+		if (it != table.end())
+		{
+			return Symbol(it->first, it->second);
+		}
+
+		return Symbol();
+	}
+
+	std::size_t Symbol::Count()
+	{
+		std::shared_lock<std::shared_mutex> lock(TableMutex());
+		return Table().Size();
+	}
+
+	Symbol::TableType& Symbol::Table()
+	{
+		// function statics so Symbols can be created during static initialization of other translation units
+		static TableType* table = []
+		{
+			Memory::UntrackedGuard untracked;
+			return new (Memory::Allocate(sizeof(TableType))) TableType(1031);
+		}();
+		return *table;
+	}
+
+	std::shared_mutex& Symbol::TableMutex()
+	{
+		static std::shared_mutex mutex;
+		return mutex;
+	}
+
+	std::string_view Symbol::Store(std::string_view name)
+	{
+		const std::size_t size = name.size() + 1;
+
+		char* characters;
+		if (size > CharacterBlockSize)
+		{
+			characters = static_cast<char*>(Memory::Allocate(size));
+		}
+		else
+		{
+			// the rest of a block too small for this name is left unused
+			if (size > sCharactersLeft)
+			{
+				sCharacters = static_cast<char*>(Memory::Allocate(CharacterBlockSize));
+				sCharactersLeft = CharacterBlockSize;
+			}
+
+			characters = sCharacters;
+			sCharacters += size;
+			sCharactersLeft -= size;
+		}
+
+		std::memcpy(characters, name.data(), name.size());
+		characters[name.size()] = '\0';
+		return std::string_view(characters, name.size());
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <shared_mutex>
+#include "hashmap.h"
+
+namespace Library
+{
+	/// <summary>
+	/// An interned string: every distinct string is stored once in a global table and given a stable id,
+	/// so Symbols hash and compare as integers instead of character by character.
+	/// Interned strings are never released, a Symbol stays valid for the lifetime of the program.
+	/// Their characters are kept in blocks the table allocates itself, so a name never moves.
+	/// The table is safe to use from multiple threads.
+	/// </summary>
+	class Symbol final
+	{
+	public:
+		/// <summary>
+		/// Default Constructor, creates an invalid Symbol that never matches an interned string
+		/// </summary>
+		Symbol() = default;
+		/// <summary>
+		/// Interns the given string
+		/// </summary>
+		/// <param name="name">string to intern</param>
+		explicit Symbol(const std::string& name);
+		/// <summary>
+		/// Interns the given string
+		/// </summary>
+		/// <param name="name">null terminated string to intern</param>
+		explicit Symbol(const char* name);
+		Symbol(const Symbol&) = default;
+		Symbol(Symbol&&) noexcept = default;
+		Symbol& operator=(const Symbol&) = default;
+		Symbol& operator=(Symbol&&) noexcept = default;
+		~Symbol() = default;
+
+		/// <summary>
+		/// Gets the Symbol for the given string, adding it to the table if it is not there yet
+		/// </summary>
+		/// <param name="name">string to intern</param>
+		/// <returns>valid Symbol</returns>
+		static Symbol Intern(const std::string& name);
+		/// <summary>
+		/// Gets the Symbol for the given string without adding to the table.
+		/// A string that was never interned cannot be a key anywhere, so lookups can stop early
+		/// </summary>
+		/// <param name="name">string to look up</param>
+		/// <returns>Symbol, invalid if the string was never interned</returns>
+		static Symbol TryFind(const std::string& name);
+		/// <summary>
+		/// Gets the number of interned strings
+		/// </summary>
+		/// <returns>size_t</returns>
+		static std::size_t Count();
+
+		/// <summary>
+		/// Returns true if the Symbol refers to an interned string
+		/// </summary>
+		/// <returns>bool</returns>
+		bool IsValid() const;
+		/// <summary>
+		/// Gets the stable id of the interned string, 0 if invalid
+		/// </summary>
+		/// <returns>size_t</returns>
+		std::size_t Id() const;
+		/// <summary>
+		/// Gets the interned string, empty if invalid
+		/// </summary>
+		/// <returns>view of the interned characters, null terminated and good for the lifetime of the program</returns>
+		std::string_view Name() const;
+		/// <summary>
+		/// Lets a Symbol be used wherever a std::string_view is expected
+		/// </summary>
+		operator std::string_view() const;
+
+		/// <summary>
+		/// Comparison operator: equal, compares ids only
+		/// </summary>
+		/// <param name="rhs">Symbol to compare to</param>
+		/// <returns>true if both refer to the same interned string</returns>
+		bool operator==(const Symbol& rhs) const;
+		/// <summary>
+		/// Comparison operator: not equal, compares ids only
+		/// </summary>
+		/// <param name="rhs">Symbol to compare to</param>
+		/// <returns>true if both refer to different interned strings</returns>
+		bool operator!=(const Symbol& rhs) const;
+
+	private:
+		Symbol(std::string_view name, std::size_t id);
+
+		using TableType = Hashmap<std::string_view, std::size_t>;
+
+		static TableType& Table();
+		static std::shared_mutex& TableMutex();
+		/// <summary>
+		/// Copies a name into the table's character blocks, the caller holds the table's lock
+		/// </summary>
+		static std::string_view Store(std::string_view name);
+
+		inline static const std::size_t CharacterBlockSize = 4096;
+
+		std::string_view mName;
+		std::size_t mId{ 0 };
+	};
+
+	template <>
+	struct DefaultHash<Symbol> final
+	{
+		std::size_t operator()(const Symbol& key) const;
+	};
+
+	template <>
+	struct DefaultHash<const Symbol> final
+	{
+		std::size_t operator()(const Symbol& key) const;
+	};
+}
+
+#include "Symbol.inl"
@@ -0,0 +1,50 @@
+#include "Symbol.h"
+
+namespace Library
+{
+	inline Symbol::Symbol(std::string_view name, std::size_t id) :
+		mName(name), mId(id)
+	{
+	}
+
+	inline bool Symbol::IsValid() const
+	{
+		return mId != 0;
+	}
+
+	inline std::size_t Symbol::Id() const
+	{
+		return mId;
+	}
+
+	inline std::string_view Symbol::Name() const
+	{
+		return mName;
+	}
+
+	inline Symbol::operator std::string_view() const
+	{
+		return Name();
+	}
+
+	inline bool Symbol::operator==(const Symbol& rhs) const
+	{
+		return mId == rhs.mId;
+	}
+
+	inline bool Symbol::operator!=(const Symbol& rhs) const
+	{
+		return !(operator==(rhs));
+	}
+
+	inline std::size_t DefaultHash<Symbol>::operator()(const Symbol& key) const
+	{
+		// ids are handed out sequentially, so they spread evenly over any bucket count
+		return key.Id();
+	}
+
+	inline std::size_t DefaultHash<const Symbol>::operator()(const Symbol& key) const
+	{
+		return key.Id();
+	}
+}
@@ -3,30 +3,111 @@
 
 namespace Library
 {
-	Hashmap<std::size_t, Vector<Signature>> TypeManager::mHashSignatureTable;
+	Hashmap<std::size_t, TypeManager::TypeDescriptor> TypeManager::mTypeDescriptorTable;
+
+	TypeManager::TypeDescriptor::TypeDescriptor(Vector<Signature> signatures) :
+		mSignatures(std::move(signatures)), mIndices(mSignatures.Size() + 1), mPrototype(mSignatures.Size() + 1), mPool(mSignatures)
+	{
+		static const Symbol thisKey("this");
+
+		mNames.Reserve(mSignatures.Size());
+		mIndices.Insert(std::make_pair(thisKey, std::size_t(0)));
+		mPrototype.Append(thisKey).SetType(Datum::DatumTypes::Table);
+		for (std::size_t i = 0; i < mSignatures.Size(); ++i)
+		{
+			const Signature& sig = mSignatures[i];
+			const Symbol name = Symbol::Intern(sig.mName);
+			mNames.PushBack(name);
+			mIndices.Insert(std::make_pair(name, i + 1));
+
+			Datum& datum = mPrototype.Append(name);
+			datum.SetType(sig.mType);
+			if (sig.mType == Datum::DatumTypes::Table && sig.mSize > 0)
+			{
+				datum.Reserve(sig.mSize);
+			}
+		}
+	}
+
+	const Vector<Signature>& TypeManager::TypeDescriptor::Signatures() const
+	{
+		return mSignatures;
+	}
+
+	const Vector<Symbol>& TypeManager::TypeDescriptor::Names() const
+	{
+		return mNames;
+	}
+
+	std::size_t TypeManager::TypeDescriptor::PrescribedCount() const
+	{
+		return mSignatures.Size() + 1; // +1 for the "this" attribute
+	}
+
+	bool TypeManager::TypeDescriptor::IsPrescribed(const Symbol& name) const
+	{
+		return mIndices.ContainsKey(name);
+	}
+
+	std::size_t TypeManager::TypeDescriptor::IndexOf(const Symbol& name) const
+	{
+		auto it = mIndices.Find(name);
+		return it != mIndices.end() ? it->second : PrescribedCount();
+	}
+
+	const Scope& TypeManager::TypeDescriptor::Prototype() const
+	{
+		return mPrototype;
+	}
+
+	AttributePool& TypeManager::TypeDescriptor::Pool()
+	{
+		return mPool;
+	}
+
+	const AttributePool& TypeManager::TypeDescriptor::Pool() const
+	{
+		return mPool;
+	}
 
 	void TypeManager::RegisterType(const std::size_t& typeId, const Vector<Signature>& signatures)
 	{
-		mHashSignatureTable.Insert(std::make_pair(typeId, signatures));
+		if (!mTypeDescriptorTable.ContainsKey(typeId))
+		{
+			mTypeDescriptorTable.Insert(std::make_pair(typeId, TypeDescriptor(signatures)));
+		}
 	}
 
 	void TypeManager::RegisterType(const std::size_t& typeId, Vector<Signature>&& signatures)
 	{
-		mHashSignatureTable.Insert(std::make_pair(typeId, std::move(signatures)));
+		if (!mTypeDescriptorTable.ContainsKey(typeId))
+		{
+			mTypeDescriptorTable.Insert(std::make_pair(typeId, TypeDescriptor(std::move(signatures))));
+		}
 	}
 
 	void TypeManager::RemoveType(std::size_t& typeId)
 	{
-		mHashSignatureTable.Remove(typeId);
+		mTypeDescriptorTable.Remove(typeId);
 	}
 
 	const Vector<Signature>& TypeManager::GetSignatures(const std::size_t& typeId)
 	{
-		return mHashSignatureTable.At(typeId);
+		return mTypeDescriptorTable.At(typeId).Signatures();
+	}
+
+	const TypeManager::TypeDescriptor& TypeManager::GetDescriptor(const std::size_t& typeId)
+	{
+		return mTypeDescriptorTable.At(typeId);
+	}
+
+	AttributePool& TypeManager::GetPool(const std::size_t& typeId)
+	{
+		return mTypeDescriptorTable.At(typeId).Pool();
 	}
 
 	void TypeManager::Clear()
 	{
-		mHashSignatureTable.Clear();
+		mTypeDescriptorTable.Clear();
 	}
 }
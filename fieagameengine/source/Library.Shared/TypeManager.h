@@ -1,13 +1,79 @@
 #pragma once
 #include "hashmap.h"
+#include "AttributePool.h"
 #include "Datum.h"
+#include "Scope.h"
 #include "Signature.h"
+#include "Symbol.h"
 
 namespace Library
 {
 	class TypeManager final
 	{
 	public:
+		/// <summary>
+		/// Everything Attributed needs to know about the prescribed attributes of a type, worked out once when the type is registered.
+		/// Immutable, Attributed uses it by reference so its queries neither copy nor allocate.
+		/// It also holds the prototype layout every new instance of the type starts from, and the AttributePool of its pooled signatures.
+		/// </summary>
+		class TypeDescriptor final
+		{
+		public:
+			/// <summary>
+			/// Constructor, interns the signature names and indexes them
+			/// </summary>
+			/// <param name="signatures">prescribed attributes of the type</param>
+			explicit TypeDescriptor(Vector<Signature> signatures);
+
+			/// <summary>
+			/// Gets the signatures the type was registered with
+			/// </summary>
+			/// <returns>signatures, with their types, sizes and offsets</returns>
+			const Vector<Signature>& Signatures() const;
+			/// <summary>
+			/// Gets the interned names of the signatures, in signature order
+			/// </summary>
+			/// <returns>Vector of Symbol</returns>
+			const Vector<Symbol>& Names() const;
+			/// <summary>
+			/// Gets the number of prescribed attributes, "this" included.
+			/// An instance's attributes from this index on are auxiliary
+			/// </summary>
+			/// <returns>size_t</returns>
+			std::size_t PrescribedCount() const;
+			/// <summary>
+			/// Returns true if the name is "this" or one of the signatures
+			/// </summary>
+			/// <param name="name">interned name</param>
+			/// <returns>bool</returns>
+			bool IsPrescribed(const Symbol& name) const;
+			/// <summary>
+			/// Gets where a prescribed attribute sits in an instance's attributes, "this" is at 0 and signature i at i + 1
+			/// </summary>
+			/// <param name="name">interned name</param>
+			/// <returns>index, PrescribedCount() if the name is not prescribed</returns>
+			std::size_t IndexOf(const Symbol& name) const;
+			/// <summary>
+			/// Gets the prototype layout: "this" and one datum per signature, typed and in order, with no storage yet.
+			/// A new instance copies it in bulk and then points the datums at its own members
+			/// </summary>
+			/// <returns>Scope</returns>
+			const Scope& Prototype() const;
+			/// <summary>
+			/// Gets the structure-of-arrays storage of the signatures declared with Signature::Pooled
+			/// </summary>
+			/// <returns>AttributePool, with no columns when the type pools nothing</returns>
+			AttributePool& Pool();
+			const AttributePool& Pool() const;
+
+		private:
+			Vector<Signature> mSignatures;
+			Vector<Symbol> mNames;
+			Hashmap<Symbol, std::size_t> mIndices;
+			Scope mPrototype;
+			AttributePool mPool;
+		};
+
 		TypeManager(const TypeManager& rhs) = delete;
 		TypeManager(TypeManager&& rhs) = delete;
 		TypeManager& operator=(const TypeManager& rhs) = delete;
@@ -39,6 +105,21 @@ namespace Library
 		/// <returns></returns>
 		static const Vector<Signature>& GetSignatures(const std::size_t& typeId);
 
+		/// <summary>
+		/// Gets the descriptor built when the type was registered
+		/// </summary>
+		/// <param name="typeId">registered type</param>
+		/// <returns>TypeDescriptor, throws if the type was never registered</returns>
+		static const TypeDescriptor& GetDescriptor(const std::size_t& typeId);
+
+		/// <summary>
+		/// Gets the pool the instances of a type keep their pooled attributes in, for systems to iterate.
+		/// The type must not be removed while any of its instances are alive
+		/// </summary>
+		/// <param name="typeId">registered type</param>
+		/// <returns>AttributePool, throws if the type was never registered</returns>
+		static AttributePool& GetPool(const std::size_t& typeId);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -48,6 +129,6 @@ namespace Library
 		TypeManager() = default;
 
 		// todo: make size_t >>> RTTI:IdType
-		static Hashmap<std::size_t, Vector<Signature>> mHashSignatureTable;
+		static Hashmap<std::size_t, TypeDescriptor> mTypeDescriptorTable;
 	};
 }
\ No newline at end of file
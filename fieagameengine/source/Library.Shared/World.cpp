@@ -1,6 +1,11 @@
 #include "pch.h"
 #include "World.h"
 #include "Sector.h"
+#include "Entity.h"
+#include "ActionList.h"
+#include "JobSystem.h"
+#include "Factory.h"
+#include "Memory.h"
 
 namespace Library
 {
@@ -21,6 +26,50 @@ namespace Library
 	{
 	}
 
+	World::World(const World& rhs) :
+		Attributed(rhs), mWorldName(rhs.mWorldName), mWorldState(rhs.mWorldState), mEventQueue(rhs.mEventQueue),
+		mGraveyard(rhs.mGraveyard), mJobSystem(rhs.mJobSystem), mUpdateMode(rhs.mUpdateMode)
+	{
+	}
+
+	World::World(World&& rhs) noexcept :
+		Attributed(std::move(rhs)), mWorldName(std::move(rhs.mWorldName)), mWorldState(rhs.mWorldState), mEventQueue(rhs.mEventQueue),
+		mGraveyard(std::move(rhs.mGraveyard)), mJobSystem(rhs.mJobSystem), mUpdateMode(rhs.mUpdateMode)
+	{
+	}
+
+	World& World::operator=(const World& rhs)
+	{
+		if (this != &rhs)
+		{
+			Attributed::operator=(rhs);
+			mWorldName = rhs.mWorldName;
+			mWorldState = rhs.mWorldState;
+			mEventQueue = rhs.mEventQueue;
+			mGraveyard = rhs.mGraveyard;
+			mJobSystem = rhs.mJobSystem;
+			mUpdateMode = rhs.mUpdateMode;
+		}
+
+		return *this;
+	}
+
+	World& World::operator=(World&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Attributed::operator=(std::move(rhs));
+			mWorldName = std::move(rhs.mWorldName);
+			mWorldState = rhs.mWorldState;
+			mEventQueue = rhs.mEventQueue;
+			mGraveyard = std::move(rhs.mGraveyard);
+			mJobSystem = rhs.mJobSystem;
+			mUpdateMode = rhs.mUpdateMode;
+		}
+
+		return *this;
+	}
+
 	const std::string& World::Name() const
 	{
 		return mWorldName;
@@ -53,27 +102,187 @@ namespace Library
 			mEventQueue->Update(mWorldState->GetGameTime());
 		}
 
+		if (mJobSystem != nullptr && (mUpdateMode == UpdateMode::ParallelSectors || mUpdateMode == UpdateMode::ParallelEntities))
+		{
+			UpdateParallel(worldState);
+
+			// created before the graveyard is emptied, the parents they were spawned for are still alive
+			CreateSpawns();
+		}
+		else
+		{
+			Datum& sectors = Sectors();
+			for (std::size_t i = 0; i < sectors.Size(); ++i)
+			{
+				Scope& sectorScope = sectors[i];
+				assert(sectorScope.Is<Sector>());
+
+				Sector& sector = static_cast<Sector&>(sectorScope);
+				worldState.sector = &sector;
+
+				if (mUpdateMode == UpdateMode::BatchedActions)
+				{
+					mActionBatcher.Update(sector, worldState);
+				}
+				else
+				{
+					sector.Update(worldState);
+				}
+			}
+		}
+
+		// every job has finished by now
+		EmptyGraveyard();
+
+		worldState.sector = nullptr;
+	}
+
+	void World::UpdateParallel(WorldState& worldState)
+	{
+		// jobs never share the sector/entity/action pointers, each slot of the job system updates through its own state
+		Vector<WorldState> states;
+		states.Reserve(mJobSystem->SlotCount());
+		for (std::size_t i = 0; i < mJobSystem->SlotCount(); ++i)
+		{
+			states.PushBack(WorldState());
+			WorldState& state = states.Back();
+			state.world = this;
+			state.SetGameTime(worldState.GetGameTime());
+		}
+
+		mIsUpdatingInParallel = true;
+		try
+		{
+			RunJobs(states);
+		}
+		catch (...)
+		{
+			// what the failed update spawned is dropped, its parents may not outlive it
+			mIsUpdatingInParallel = false;
+			mSpawns.Clear();
+			throw;
+		}
+		mIsUpdatingInParallel = false;
+	}
+
+	void World::RunJobs(Vector<WorldState>& states)
+	{
 		Datum& sectors = Sectors();
-		for (std::size_t i = 0; i < sectors.Size(); ++i)
+		if (mUpdateMode == UpdateMode::ParallelSectors)
+		{
+			mJobSystem->ParallelFor(sectors.Size(), [&sectors, &states](std::size_t index, std::size_t slot)
+			{
+				Scope& sectorScope = sectors[index];
+				assert(sectorScope.Is<Sector>());
+
+				Sector& sector = static_cast<Sector&>(sectorScope);
+				WorldState& state = states[slot];
+				state.sector = &sector;
+
+				sector.Update(state);
+			});
+		}
+		else
+		{
+			Vector<Entity*> entities;
+			for (std::size_t i = 0; i < sectors.Size(); ++i)
+			{
+				Scope& sectorScope = sectors[i];
+				assert(sectorScope.Is<Sector>());
+
+				Datum& sectorEntities = static_cast<Sector&>(sectorScope).Entities();
+				for (std::size_t j = 0; j < sectorEntities.Size(); ++j)
+				{
+					Scope& entityScope = sectorEntities[j];
+					assert(entityScope.Is<Entity>());
+					entities.PushBack(static_cast<Entity*>(&entityScope));
+				}
+			}
+
+			mJobSystem->ParallelFor(entities.Size(), [&entities, &states](std::size_t index, std::size_t slot)
+			{
+				Entity& entity = *entities[index];
+				WorldState& state = states[slot];
+				state.sector = entity.GetSector();
+
+				entity.Update(state);
+			});
+		}
+	}
+
+	void World::Spawn(Scope& parent, const std::string& className, const std::string& instanceName)
+	{
+		if (mIsUpdatingInParallel)
 		{
-			Scope& sectorScope = sectors[i];
-			assert(sectorScope.Is(Sector::TypeIdClass()));
+			std::scoped_lock<std::mutex> lock(mSpawnsMutex);
+			mSpawns.PushBack({ &parent, className, instanceName });
+			return;
+		}
 
-			Sector& sector = static_cast<Sector&>(sectorScope);
-			worldState.sector = &sector;
+		Create(parent, className, instanceName);
+	}
+
+	bool World::IsUpdatingInParallel() const
+	{
+		return mIsUpdatingInParallel;
+	}
 
-			sector.Update(worldState);
+	void World::CreateSpawns()
+	{
+		Vector<PendingSpawn> spawns(std::move(mSpawns));
+		for (const PendingSpawn& spawn : spawns)
+		{
+			// a buried parent is destroyed with everything it holds right after
+			if (spawn.Parent->mIsBuried || HasBuriedAncestor(*spawn.Parent))
+			{
+				continue;
+			}
+
+			Create(*spawn.Parent, spawn.ClassName, spawn.InstanceName);
 		}
+	}
 
-		// Delete Graveyard (marked actions to delete)
-		for (auto& entry : mGraveyard)
+	void World::Create(Scope& parent, const std::string& className, const std::string& instanceName)
+	{
+		if (parent.Is<Sector>())
+		{
+			static_cast<Sector&>(parent).CreateEntity(className, instanceName);
+		}
+		else if (parent.Is<Entity>())
+		{
+			static_cast<Entity&>(parent).CreateAction(className, instanceName);
+		}
+		else if (parent.Is<ActionList>())
 		{
-			entry->OrphanSelf();
-			delete entry;
+			static_cast<ActionList&>(parent).CreateAction(className, instanceName);
 		}
-		mGraveyard.Clear();
+	}
 
-		worldState.sector = nullptr;
+	void World::SetJobSystem(JobSystem* jobSystem, UpdateMode mode)
+	{
+		mJobSystem = jobSystem;
+		const bool isParallel = (mode == UpdateMode::ParallelSectors || mode == UpdateMode::ParallelEntities);
+		mUpdateMode = (jobSystem == nullptr && isParallel) ? UpdateMode::Serial : mode;
+	}
+
+	JobSystem* World::GetJobSystem() const
+	{
+		return mJobSystem;
+	}
+
+	World::UpdateMode World::GetUpdateMode() const
+	{
+		return mUpdateMode;
+	}
+
+	void World::SetUpdateMode(UpdateMode mode)
+	{
+		if (mJobSystem == nullptr && (mode == UpdateMode::ParallelSectors || mode == UpdateMode::ParallelEntities))
+		{
+			throw std::runtime_error("Parallel updates need a job system.");
+		}
+
+		mUpdateMode = mode;
 	}
 
 	gsl::owner<Scope*> World::Clone() const
@@ -90,34 +299,67 @@ namespace Library
 		};
 	}
 
-	SList<Scope*>& World::GetGraveyard()
+	Vector<Scope*>& World::GetGraveyard()
 	{
 		return mGraveyard;
 	}
 
 	void World::Bury(Scope* scope)
 	{
-		bool isAlreadyBuried = false;
-		Scope* tempScope = scope;
+		std::scoped_lock<std::mutex> lock(mGraveyardMutex);
 
 		// search if self or parent(some ancestor) is buried already
-		while (!isAlreadyBuried && tempScope->Is(Action::TypeIdClass()))
+		if (scope->mIsBuried || HasBuriedAncestor(*scope))
+		{
+			return;
+		}
+
+		scope->mIsBuried = true;
+		mGraveyard.PushBack(scope);
+	}
+
+	bool World::HasBuriedAncestor(const Scope& scope) const
+	{
+		for (const Scope* ancestor = scope.GetParent(); ancestor != nullptr; ancestor = ancestor->GetParent())
 		{
-			for (auto& entry : mGraveyard)
+			if (ancestor->mIsBuried)
 			{
-				if (entry == tempScope)
-				{
-					isAlreadyBuried = true;
-					break;
-				}
+				return true;
 			}
+		}
 
-			tempScope = tempScope->GetParent();
+		return false;
+	}
+
+	void World::EmptyGraveyard()
+	{
+		// keep the roots of the buried subtrees only, nothing is destroyed before every entry has been checked
+		std::size_t rootCount = 0;
+		for (std::size_t i = 0; i < mGraveyard.Size(); ++i)
+		{
+			if (!HasBuriedAncestor(*mGraveyard[i]))
+			{
+				mGraveyard[rootCount++] = mGraveyard[i];
+			}
 		}
 
-		if (!isAlreadyBuried)
+		// emptied before anything is recycled, whatever happens on the way nothing here is recycled again next frame
+		Vector<Scope*> graveyard(std::move(mGraveyard));
+
+		// Recycle the roots into the factory pools, their subtrees go with them
+		for (std::size_t i = 0; i < rootCount; ++i)
 		{
-			mGraveyard.PushBack(scope);
+			Scope* root = graveyard[i];
+			root->OrphanSelf();
+			if (Memory::IsArenaAllocation(root))
+			{
+				// the arena releases its memory at once, it cannot be pooled
+				delete root;
+			}
+			else
+			{
+				Factory<Scope>::Recycle(root);
+			}
 		}
 	}
 
@@ -1,21 +1,38 @@
 #pragma once
 #include "Attributed.h"
-#include "SList.h"
 #include "Scope.h"
 #include "TypeManager.h"
 #include "EventQueue.h"
 #include "Reaction.h"
+#include "ActionBatcher.h"
+#include <mutex>
 
 namespace Library
 {
 	class Sector;
 	class WorldState;
+	class JobSystem;
 
 	class World final : public Attributed
 	{
 		RTTI_DECLARATIONS(World, Attributed)
 
 	public:
+		/// <summary>
+		/// How Update walks the world. Serial updates sectors, entities and actions in order on the calling thread.
+		/// ParallelSectors runs one job per sector, ParallelEntities one job per entity across all sectors, in which case
+		/// an entity may only write to itself and its children. The parallel modes give every job slot its own WorldState.
+		/// BatchedActions runs serially too, but each sector's actions run grouped by concrete type (see ActionBatcher).
+		/// The batches call Action::Update directly and Sector::Update and Entity::Update are not called: whatever a sector
+		/// or entity type does in Update besides running its actions is skipped in this mode.
+		/// </summary>
+		enum class UpdateMode
+		{
+			Serial,
+			ParallelSectors,
+			ParallelEntities,
+			BatchedActions
+		};
 
 #pragma region Constructors, Assignments & Destructor:
 		/// <summary>
@@ -31,25 +48,25 @@ namespace Library
 		/// Copy Constructor
 		/// </summary>
 		/// <param name="rhs">Takes in a const World reference</param>
-		World(const World& rhs) = default;
+		World(const World& rhs);
 		/// <summary>
 		/// Move Constructor
 		/// </summary>
 		/// <param name="rhs">Takes in a World&&</param>
 		/// <returns>Moved World</returns>
-		World(World&& rhs) noexcept = default;
+		World(World&& rhs) noexcept;
 		/// <summary>
 		/// Copy Assignment
 		/// </summary>
 		/// <param name="rhs">Takes in a const World reference</param>
 		/// <returns>Copied World</returns>
-		World& operator=(const World& rhs) = default;
+		World& operator=(const World& rhs);
 		/// <summary>
 		/// Move Assignment
 		/// </summary>
 		/// <param name="rhs">Takes in a World&&</param>
 		/// <returns>Moved World</returns>
-		World& operator=(World&& rhs) noexcept = default;
+		World& operator=(World&& rhs) noexcept;
 		/// <summary>
 		/// Destructor
 		/// </summary>
@@ -86,6 +103,28 @@ namespace Library
 		/// <param name="worldState">WorldState</param>
 		void Update(WorldState& worldState);
 
+		/// <summary>
+		/// Selects how Update walks the sectors. Without a job system the parallel modes fall back to Serial, the others are kept
+		/// </summary>
+		/// <param name="jobSystem">job system to update on, not owned, nullptr for serial updates</param>
+		/// <param name="mode">update mode</param>
+		void SetJobSystem(JobSystem* jobSystem, UpdateMode mode = UpdateMode::ParallelSectors);
+		/// <summary>
+		/// Gets the job system Update runs on
+		/// </summary>
+		/// <returns>job system, nullptr when updating serially</returns>
+		JobSystem* GetJobSystem() const;
+		/// <summary>
+		/// Gets the update mode
+		/// </summary>
+		/// <returns>UpdateMode</returns>
+		UpdateMode GetUpdateMode() const;
+		/// <summary>
+		/// Sets the update mode, the parallel modes need a job system (throws without one)
+		/// </summary>
+		/// <param name="mode">update mode</param>
+		void SetUpdateMode(UpdateMode mode);
+
 		/// <summary>
 		/// Create a clone of an world
 		/// </summary>
@@ -101,19 +140,89 @@ namespace Library
 		/// <summary>
 		/// Get Graveyard storing actions to be destroyed
 		/// </summary>
-		/// <returns>SList of Scope pointers (actions)</returns>
-		SList<Scope*>& GetGraveyard();
+		/// <returns>Vector of Scope pointers (actions), in the order they were buried</returns>
+		Vector<Scope*>& GetGraveyard();
+		/// <summary>
+		/// Marks a scope for deletion at the end of Update, unless it or an ancestor already is (checked in O(depth) through a flag on each scope).
+		/// Heap allocated scopes are recycled into the pool of their factory rather than deleted.
+		/// Safe to call from several jobs at once
+		/// </summary>
+		/// <param name="scope">scope to delete</param>
 		void Bury(Scope* scope);
+
+		/// <summary>
+		/// Creates an entity in a sector, or an action in an entity or an action list, through the factory.
+		/// While the jobs of a parallel update run it is queued instead, and created once they have all finished but before the graveyard
+		/// is emptied (nothing is created under a buried parent): constructing a type with pooled attributes moves the rows of its pool,
+		/// which the other jobs are using. Safe to call from several jobs at once
+		/// </summary>
+		/// <param name="parent">sector, entity or action list to create into</param>
+		/// <param name="className">class the factory creates</param>
+		/// <param name="instanceName">name given to the created scope</param>
+		void Spawn(Scope& parent, const std::string& className, const std::string& instanceName);
+
+		/// <summary>
+		/// Tells whether the jobs of a parallel update are running, Spawn defers what it creates meanwhile
+		/// </summary>
+		/// <returns>true during the jobs of ParallelSectors and ParallelEntities updates</returns>
+		bool IsUpdatingInParallel() const;
 		
 		WorldState& GetWorldState();
 
 		EventQueue& GetEventQueue();
 		
 	private:
+		/// <summary>
+		/// Updates the sectors on the job system, one WorldState per job slot
+		/// </summary>
+		void UpdateParallel(WorldState& worldState);
+
+		/// <summary>
+		/// Runs the jobs of a parallel update, the one of each slot updating through its state
+		/// </summary>
+		void RunJobs(Vector<WorldState>& states);
+
+		/// <summary>
+		/// Tells whether one of the ancestors of a scope is buried
+		/// </summary>
+		bool HasBuriedAncestor(const Scope& scope) const;
+
+		/// <summary>
+		/// Destroys the graveyard in one pass, a scope buried along with one of its ancestors goes with the ancestor's subtree
+		/// </summary>
+		void EmptyGraveyard();
+
+		/// <summary>
+		/// Creates what Spawn queued during the jobs, in the order it was queued
+		/// </summary>
+		void CreateSpawns();
+
+		/// <summary>
+		/// Creates a scope into its parent right away
+		/// </summary>
+		static void Create(Scope& parent, const std::string& className, const std::string& instanceName);
+
+		/// <summary>
+		/// Scope Spawn queued during the jobs of a parallel update
+		/// </summary>
+		struct PendingSpawn final
+		{
+			Scope* Parent{ nullptr };
+			std::string ClassName;
+			std::string InstanceName;
+		};
+
 		std::string mWorldName;
 		WorldState* mWorldState{ nullptr };
 		EventQueue* mEventQueue{ nullptr };
-		SList<Scope*> mGraveyard;
+		Vector<Scope*> mGraveyard;
+		std::mutex mGraveyardMutex;
+		Vector<PendingSpawn> mSpawns;
+		std::mutex mSpawnsMutex;
+		bool mIsUpdatingInParallel{ false };
+		JobSystem* mJobSystem{ nullptr };
+		UpdateMode mUpdateMode{ UpdateMode::Serial };
+		ActionBatcher mActionBatcher;
 		
 		const static inline std::size_t sectorsIndex = 2;
 	};
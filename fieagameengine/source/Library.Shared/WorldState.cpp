@@ -12,7 +12,7 @@ namespace Library
 	{
 		mGameTime = gameTime;
 	}
-	Stack<Scope>& WorldState::GetCallStack()
+	Stack<CallFrame>& WorldState::GetCallStack()
 	{
 		return mCallStack;
 	}
@@ -2,7 +2,7 @@
 #include "GameClock.h"
 #include "GameTime.h"
 #include "Stack.h"
-#include "Scope.h"
+#include "CallFrame.h"
 
 namespace Library
 {
@@ -21,7 +21,11 @@ namespace Library
 		/// <param name="gameTime">GameTime</param>
 		void SetGameTime(const GameTime& gameTime);
 
-		Stack<Scope>& GetCallStack();
+		/// <summary>
+		/// Get the call stack, the arguments of the reactions that are running
+		/// </summary>
+		/// <returns>Stack of CallFrame</returns>
+		Stack<CallFrame>& GetCallStack();
 		
 		class World* world = nullptr;
 		class Sector* sector = nullptr;
@@ -31,7 +35,7 @@ namespace Library
 		GameClock mGameClock;
 		GameTime mGameTime;
 
-		Stack<Scope> mCallStack;
+		Stack<CallFrame> mCallStack;
 	};
 
 }
\ No newline at end of file
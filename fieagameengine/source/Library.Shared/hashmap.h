@@ -1,25 +1,30 @@
 #pragma once
+#include <algorithm>
+#include <cmath>
 #include "vector.h"
 #include "SList.h"
 
 #include "DefaultEquality.h"
 #include "DefaultHash.h"
+#include "FunctorPolicy.h"
 
 namespace Library
 {
 	/// <summary>
 	/// Represents a Templated Hashmap using Chaining with a Vector List 
-	/// Combined with a Singularly Linked List
+	/// Combined with a Singularly Linked List.
+	/// THash and TEquality default to stateless functors the compiler inlines;
+	/// use RuntimeHashmap to pick them at runtime.
 	/// </summary>
-	template <typename TKey, typename TData>
+	template <typename TKey, typename TData, typename THash = DefaultHash<TKey>, typename TEquality = DefaultEquality<TKey>>
 	class Hashmap final
 	{
 	public:
 		using PairType = std::pair<const TKey, TData>;
 		using ChainType = SList<PairType>;
 		using BucketType = Vector<ChainType>;
-		using HashFunctor = std::function<size_t(const TKey&)>;
-		using EqualityFunctor = std::function<bool(const TKey&, const TKey&)>;
+		using HashFunctor = THash;
+		using EqualityFunctor = TEquality;
 
 		/// <summary>
 		/// Embedded class for Hashmap to use to traverse its members.
@@ -231,7 +236,7 @@ namespace Library
 		/// </summary>
 		/// <param name="bucketSize">size_t, needs to be > 0</param>
 		/// <param name="hashFunctor">if none is provided, a Default one given</param>
-		explicit Hashmap(size_t bucketSize = 31, HashFunctor hashFunctor = DefaultHash<TKey>(), EqualityFunctor equalityFunctor = DefaultEquality<TKey>());
+		explicit Hashmap(size_t bucketSize = 31, HashFunctor hashFunctor = DefaultFunctor<HashFunctor, DefaultHash<TKey>>(), EqualityFunctor equalityFunctor = DefaultFunctor<EqualityFunctor, DefaultEquality<TKey>>());
 		/// <summary>
 		/// Copy Constructor
 		/// </summary>
@@ -263,7 +268,7 @@ namespace Library
 		/// Inserts a list of PairType values into the Hashmap
 		/// </summary>
 		/// <param name="list">list of PairType to insert</param>
-		Hashmap(std::initializer_list<PairType> list, HashFunctor hashFunctor = DefaultHash<TKey>(), EqualityFunctor equalityFunctor = DefaultEquality<TKey>());
+		Hashmap(std::initializer_list<PairType> list, HashFunctor hashFunctor = DefaultFunctor<HashFunctor, DefaultHash<TKey>>(), EqualityFunctor equalityFunctor = DefaultFunctor<EqualityFunctor, DefaultEquality<TKey>>());
 
 		/// <summary>
 		/// Takes an entry argument of the appropriate type (constant reference to PairType) and which returns an Iterator. 
@@ -329,6 +334,39 @@ namespace Library
 		/// <returns>Boolean</returns>
 		const bool ContainsKey(const TKey& key) const;
 
+		/// <summary>
+		/// Redistributes every entry into the given number of buckets (never fewer than the max load factor allows).
+		/// Chain nodes are relinked rather than copied, so pointers/references to entries stay valid; iterators do not.
+		/// </summary>
+		/// <param name="bucketSize">requested number of buckets</param>
+		void Rehash(size_t bucketSize);
+		/// <summary>
+		/// Grows the bucket count so that the given number of entries fits without exceeding the max load factor
+		/// </summary>
+		/// <param name="count">number of entries to make room for</param>
+		void Reserve(size_t count);
+
+		/// <summary>
+		/// Gets the average number of entries per bucket
+		/// </summary>
+		/// <returns>Size() / BucketSize()</returns>
+		const float LoadFactor() const;
+		/// <summary>
+		/// Gets the load factor past which an Insert grows the bucket count
+		/// </summary>
+		/// <returns>max load factor</returns>
+		const float MaxLoadFactor() const;
+		/// <summary>
+		/// Sets the load factor past which an Insert grows the bucket count, rehashes right away if already past it
+		/// </summary>
+		/// <param name="maxLoadFactor">needs to be > 0</param>
+		void SetMaxLoadFactor(float maxLoadFactor);
+		/// <summary>
+		/// Gets the number of entries in the fullest bucket, a quick measure of hash quality
+		/// </summary>
+		/// <returns>length of the longest chain</returns>
+		const size_t LongestChain() const;
+
 		/// <summary>
 		/// Returns an Hashmap::Iterator pointing to the head of the list
 		/// </summary>
@@ -361,14 +399,27 @@ namespace Library
 		/// <returns>Returns an Hashmap::ConstIterator pointing one past the end of the list.</returns>
 		ConstIterator cend() const;
 
+		inline static const float DefaultMaxLoadFactor = 1.0f;
+
 	private:
+		/// <summary>
+		/// Doubles the bucket count when one more entry would exceed the max load factor
+		/// </summary>
+		void GrowIfNeeded();
 
 		BucketType mBucket;
 		size_t mBucketSize{ 0 };
 		size_t mSize{ 0 };
+		float mMaxLoadFactor{ DefaultMaxLoadFactor };
 		HashFunctor mHashFunctor;
 		EqualityFunctor mEqualityFunctor;
 	};
+
+	/// <summary>
+	/// Hashmap whose hash and equality are std::functions, for callers that configure them at runtime
+	/// </summary>
+	template <typename TKey, typename TData>
+	using RuntimeHashmap = Hashmap<TKey, TData, HashFunction<TKey>, EqualityFunction<TKey>>;
 }
 
 #include "hashmap.inl"
\ No newline at end of file
@@ -4,15 +4,15 @@ namespace Library
 {
 #pragma region Iterator
 
-	template<typename TKey, typename TData>
-	inline Hashmap<TKey, TData>::Iterator::Iterator(Hashmap* owner, typename ChainType::Iterator chainIterator, size_t index) :
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline Hashmap<TKey, TData, THash, TEquality>::Iterator::Iterator(Hashmap* owner, typename ChainType::Iterator chainIterator, size_t index) :
 		mOwner(owner), mChainIterator(chainIterator), mIndex(index)
 	{
 	}
 
 	// pre-increment
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::Iterator& Hashmap<TKey, TData>::Iterator::operator++()
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::Iterator& Hashmap<TKey, TData, THash, TEquality>::Iterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -52,8 +52,8 @@ namespace Library
 	}
 
 	// post-increment
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::Iterator::operator++(int)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::Iterator Hashmap<TKey, TData, THash, TEquality>::Iterator::operator++(int)
 	{
 		Iterator temp = *this;
 		operator++();
@@ -61,26 +61,26 @@ namespace Library
 		return temp;
 	}
 
-	template<typename TKey, typename TData>
-	inline const bool Hashmap<TKey, TData>::Iterator::operator==(const Iterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool Hashmap<TKey, TData, THash, TEquality>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return (mOwner == rhs.mOwner) && (mChainIterator == rhs.mChainIterator) && (mIndex == rhs.mIndex);
 	}
 
-	template<typename TKey, typename TData>
-	inline const bool Hashmap<TKey, TData>::Iterator::operator!=(const Iterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool Hashmap<TKey, TData, THash, TEquality>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return !(operator==(rhs));
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::PairType& Hashmap<TKey, TData>::Iterator::operator*() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::PairType& Hashmap<TKey, TData, THash, TEquality>::Iterator::operator*() const
 	{
 		return *mChainIterator;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::PairType* Hashmap<TKey, TData>::Iterator::operator->() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::PairType* Hashmap<TKey, TData, THash, TEquality>::Iterator::operator->() const
 	{
 		return &(*mChainIterator);
 	}
@@ -89,21 +89,21 @@ namespace Library
 
 #pragma region ConstIterator
 
-	template<typename TKey, typename TData>
-	inline Hashmap<TKey, TData>::ConstIterator::ConstIterator(const Iterator& it) :
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline Hashmap<TKey, TData, THash, TEquality>::ConstIterator::ConstIterator(const Iterator& it) :
 		mOwner(it.mOwner), mChainIterator(it.mChainIterator), mIndex(it.mIndex)
 	{
 	}
 
-	template<typename TKey, typename TData>
-	inline Hashmap<TKey, TData>::ConstIterator::ConstIterator(const Hashmap* owner, typename ChainType::ConstIterator chainIterator, size_t index) :
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline Hashmap<TKey, TData, THash, TEquality>::ConstIterator::ConstIterator(const Hashmap* owner, typename ChainType::ConstIterator chainIterator, size_t index) :
 		mOwner(owner), mChainIterator(chainIterator), mIndex(index)
 	{
 	}
 
 	// pre-increment
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator& Hashmap<TKey, TData>::ConstIterator::operator++()
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator& Hashmap<TKey, TData, THash, TEquality>::ConstIterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -143,8 +143,8 @@ namespace Library
 	}
 
 	// post-increment
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::ConstIterator::operator++(int)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator Hashmap<TKey, TData, THash, TEquality>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp = *this;
 		operator++();
@@ -152,26 +152,26 @@ namespace Library
 		return temp;
 	}
 
-	template<typename TKey, typename TData>
-	inline const bool Hashmap<TKey, TData>::ConstIterator::operator==(const ConstIterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool Hashmap<TKey, TData, THash, TEquality>::ConstIterator::operator==(const ConstIterator& rhs) const
 	{
 		return (mOwner == rhs.mOwner) && (mChainIterator == rhs.mChainIterator) && (mIndex == rhs.mIndex);
 	}
 
-	template<typename TKey, typename TData>
-	inline const bool Hashmap<TKey, TData>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool Hashmap<TKey, TData, THash, TEquality>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
 		return !(operator==(rhs));
 	}
 	
-	template<typename TKey, typename TData>
-	inline const typename Hashmap<TKey, TData>::PairType& Hashmap<TKey, TData>::ConstIterator::operator*() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const typename Hashmap<TKey, TData, THash, TEquality>::PairType& Hashmap<TKey, TData, THash, TEquality>::ConstIterator::operator*() const
 	{
 		return *mChainIterator;
 	}
 
-	template<typename TKey, typename TData>
-	inline const typename Hashmap<TKey, TData>::PairType* Hashmap<TKey, TData>::ConstIterator::operator->() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const typename Hashmap<TKey, TData, THash, TEquality>::PairType* Hashmap<TKey, TData, THash, TEquality>::ConstIterator::operator->() const
 	{
 		return &(*mChainIterator);
 	}
@@ -182,8 +182,8 @@ namespace Library
 
 #pragma region Constructors, Destructor & Assignments
 
-	template<typename TKey, typename TData>
-	inline Hashmap<TKey, TData>::Hashmap(size_t bucketSize, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline Hashmap<TKey, TData, THash, TEquality>::Hashmap(size_t bucketSize, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
 		mBucketSize(bucketSize), mHashFunctor(hashFunctor), mEqualityFunctor(equalityFunctor)
 	{
 		mBucket.Resize(bucketSize);
@@ -193,11 +193,12 @@ namespace Library
 
 #pragma region Functions
 
-	template<typename TKey, typename TData>
-	inline Hashmap<TKey, TData>::Hashmap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline Hashmap<TKey, TData, THash, TEquality>::Hashmap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
 		mHashFunctor(hashFunctor), mEqualityFunctor(equalityFunctor)
 	{
-		mBucket.Resize(list.size());
+		mBucketSize = std::max(list.size(), size_t(1));
+		mBucket.Resize(mBucketSize);
 
 		for (auto& pair : list)
 		{
@@ -205,8 +206,8 @@ namespace Library
 		}
 	}
 
-	template<typename TKey, typename TData>
-	inline std::tuple<typename Hashmap<TKey, TData>::Iterator, bool> Hashmap<TKey, TData>::Insert(const PairType& pair)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline std::tuple<typename Hashmap<TKey, TData, THash, TEquality>::Iterator, bool> Hashmap<TKey, TData, THash, TEquality>::Insert(const PairType& pair)
 	{
 		size_t hash = mHashFunctor(pair.first);
 		size_t bucket = hash % mBucket.Size();
@@ -219,18 +220,21 @@ namespace Library
 
 		if (it == mBucket.At(bucket).end())
 		{
+			GrowIfNeeded();
+			bucket = hash % mBucket.Size();
+
 			mBucket.At(bucket).PushFront(pair);
 			++mSize;
-			return std::tuple<Iterator, bool>(Hashmap<TKey, TData>::Iterator(this, mBucket.At(bucket).begin(), bucket), true);
+			return std::tuple<Iterator, bool>(Hashmap<TKey, TData, THash, TEquality>::Iterator(this, mBucket.At(bucket).begin(), bucket), true);
 		}
 		else
 		{
-			return std::tuple<Iterator, bool>(Hashmap<TKey, TData>::Iterator(this, it, bucket), false);
+			return std::tuple<Iterator, bool>(Hashmap<TKey, TData, THash, TEquality>::Iterator(this, it, bucket), false);
 		}
 	}
 
-	template<typename TKey, typename TData>
-	inline std::tuple<typename Hashmap<TKey, TData>::Iterator, bool> Hashmap<TKey, TData>::Insert(PairType&& pair)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline std::tuple<typename Hashmap<TKey, TData, THash, TEquality>::Iterator, bool> Hashmap<TKey, TData, THash, TEquality>::Insert(PairType&& pair)
 	{
 		size_t hash = mHashFunctor(pair.first);
 		size_t bucket = hash % mBucket.Size();
@@ -243,18 +247,21 @@ namespace Library
 
 		if (it == mBucket.At(bucket).end())
 		{
+			GrowIfNeeded();
+			bucket = hash % mBucket.Size();
+
 			mBucket.At(bucket).PushFront(std::move(pair));
 			++mSize;
-			return std::tuple<Iterator, bool>(Hashmap<TKey, TData>::Iterator(this, mBucket.At(bucket).begin(), bucket), true);
+			return std::tuple<Iterator, bool>(Hashmap<TKey, TData, THash, TEquality>::Iterator(this, mBucket.At(bucket).begin(), bucket), true);
 		}
 		else
 		{
-			return std::tuple<Iterator, bool>(Hashmap<TKey, TData>::Iterator(this, it, bucket), false);
+			return std::tuple<Iterator, bool>(Hashmap<TKey, TData, THash, TEquality>::Iterator(this, it, bucket), false);
 		}
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::Find(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::Iterator Hashmap<TKey, TData, THash, TEquality>::Find(const TKey& key)
 	{
 		size_t hash = mHashFunctor(key);
 		size_t bucket = hash % mBucket.Size();
@@ -271,8 +278,8 @@ namespace Library
 		return end();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::Find(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator Hashmap<TKey, TData, THash, TEquality>::Find(const TKey& key) const
 	{
 		size_t hash = mHashFunctor(key);
 		size_t bucket = hash % mBucket.Size();
@@ -289,14 +296,14 @@ namespace Library
 		return cend();
 	}
 
-	template<typename TKey, typename TData>
-	inline void Hashmap<TKey, TData>::Remove(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::Remove(const TKey& key)
 	{
 		Remove(Find(key));
 	}
 
-	template<typename TKey, typename TData>
-	inline void Hashmap<TKey, TData>::Remove(const Iterator& it)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::Remove(const Iterator& it)
 	{
 		if (it.mOwner != this)
 		{
@@ -310,8 +317,8 @@ namespace Library
 		}
 	}
 
-	template<typename TKey, typename TData>
-	inline const bool Hashmap<TKey, TData>::ContainsKey(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const bool Hashmap<TKey, TData, THash, TEquality>::ContainsKey(const TKey& key) const
 	{
 		size_t hash = mHashFunctor(key);
 		size_t bucket = hash % mBucket.Size();
@@ -325,8 +332,8 @@ namespace Library
 		return it != mBucket.At(bucket).end();
 	}
 
-	template<typename TKey, typename TData>
-	inline void Hashmap<TKey, TData>::Clear()
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::Clear()
 	{
 		if (mSize == 0)
 		{
@@ -341,8 +348,8 @@ namespace Library
 		mSize = 0;
 	}
 
-	template<typename TKey, typename TData>
-	inline TData& Hashmap<TKey, TData>::operator[](const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline TData& Hashmap<TKey, TData, THash, TEquality>::operator[](const TKey& key)
 	{
 		size_t hash = mHashFunctor(key);
 		size_t bucket = hash % mBucket.Size();
@@ -355,6 +362,9 @@ namespace Library
 
 		if (it == mBucket.At(bucket).end())
 		{
+			GrowIfNeeded();
+			bucket = hash % mBucket.Size();
+
 			mBucket.At(bucket).PushFront(std::pair<TKey, TData>(key, TData()));
 			it = mBucket.At(bucket).begin();
 			++mSize;
@@ -363,18 +373,84 @@ namespace Library
 		return (*it).second;
 	}
 
-	template<typename TKey, typename TData>
-	inline const TData& Hashmap<TKey, TData>::operator[](const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const TData& Hashmap<TKey, TData, THash, TEquality>::operator[](const TKey& key) const
 	{
 		return this->At(key);
 	}
 
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::Rehash(size_t bucketSize)
+	{
+		size_t minimumBucketSize = static_cast<size_t>(std::ceil(static_cast<float>(mSize) / mMaxLoadFactor));
+		bucketSize = std::max({ bucketSize, minimumBucketSize, size_t(1) });
+
+		if (bucketSize == mBucket.Size())
+		{
+			return;
+		}
+
+		BucketType newBucket;
+		newBucket.Resize(bucketSize);
+
+		for (ChainType& chain : mBucket)
+		{
+			while (!chain.IsEmpty())
+			{
+				size_t bucket = mHashFunctor(chain.Front().first) % bucketSize;
+				newBucket.At(bucket).SpliceFront(chain);
+			}
+		}
+
+		mBucket = std::move(newBucket);
+		mBucketSize = bucketSize;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::Reserve(size_t count)
+	{
+		size_t bucketSize = static_cast<size_t>(std::ceil(static_cast<float>(count) / mMaxLoadFactor));
+
+		if (bucketSize > mBucket.Size())
+		{
+			Rehash(bucketSize);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		if (maxLoadFactor <= 0.0f)
+		{
+			throw std::runtime_error("Max load factor needs to be greater than 0.");
+		}
+
+		mMaxLoadFactor = maxLoadFactor;
+
+		if (LoadFactor() > mMaxLoadFactor)
+		{
+			Rehash(0);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline void Hashmap<TKey, TData, THash, TEquality>::GrowIfNeeded()
+	{
+		size_t bucketSize = mBucket.Size();
+
+		if (bucketSize == 0 || static_cast<float>(mSize + 1) > static_cast<float>(bucketSize) * mMaxLoadFactor)
+		{
+			// keep the count odd, weak hashes spread better over a modulus with no factor of two
+			Rehash(bucketSize * 2 + 1);
+		}
+	}
+
 #pragma endregion Functions
 
 #pragma region Member Accessors
 
-	template<typename TKey, typename TData>
-	inline TData& Hashmap<TKey, TData>::At(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline TData& Hashmap<TKey, TData, THash, TEquality>::At(const TKey& key)
 	{
 		size_t hash = mHashFunctor(key);
 		size_t bucket = hash % mBucket.Size();
@@ -393,8 +469,8 @@ namespace Library
 		return (*it).second;
 	}
 
-	template<typename TKey, typename TData>
-	inline const TData& Hashmap<TKey, TData>::At(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const TData& Hashmap<TKey, TData, THash, TEquality>::At(const TKey& key) const
 	{
 		size_t hash = mHashFunctor(key);
 		size_t bucket = hash % mBucket.Size();
@@ -413,24 +489,49 @@ namespace Library
 		return (*it).second;
 	}
 
-	template<typename TKey, typename TData>
-	inline const size_t Hashmap<TKey, TData>::Size() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const size_t Hashmap<TKey, TData, THash, TEquality>::Size() const
 	{
 		return mSize;
 	}
 
-	template<typename TKey, typename TData>
-	inline const size_t Hashmap<TKey, TData>::BucketSize() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const size_t Hashmap<TKey, TData, THash, TEquality>::BucketSize() const
 	{
 		return mBucket.Size();
 	}
 
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const float Hashmap<TKey, TData, THash, TEquality>::LoadFactor() const
+	{
+		return (mBucket.Size() == 0 ? 0.0f : static_cast<float>(mSize) / static_cast<float>(mBucket.Size()));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const float Hashmap<TKey, TData, THash, TEquality>::MaxLoadFactor() const
+	{
+		return mMaxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline const size_t Hashmap<TKey, TData, THash, TEquality>::LongestChain() const
+	{
+		size_t longest = 0;
+
+		for (const ChainType& chain : mBucket)
+		{
+			longest = std::max(longest, chain.Size());
+		}
+
+		return longest;
+	}
+
 #pragma endregion Member Accessors
 
 #pragma region Iterator Accessors
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::begin()
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::Iterator Hashmap<TKey, TData, THash, TEquality>::begin()
 	{
 		Iterator it = Iterator(this, this->mBucket.At(0).begin(), 0);
 		while (it.mIndex != it.mOwner->BucketSize())
@@ -452,8 +553,8 @@ namespace Library
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::begin() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator Hashmap<TKey, TData, THash, TEquality>::begin() const
 	{
 		ConstIterator it = ConstIterator(this, this->mBucket.At(0).begin(), 0);
 		while (it.mIndex != it.mOwner->BucketSize())
@@ -475,26 +576,26 @@ namespace Library
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::cbegin() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator Hashmap<TKey, TData, THash, TEquality>::cbegin() const
 	{
 		return this->begin();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::end()
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::Iterator Hashmap<TKey, TData, THash, TEquality>::end()
 	{
-		return Iterator(this, this->mBucket.At(mBucket.Size() -1).begin(), mBucket.Size());
+		return Iterator(this, this->mBucket.At(mBucket.Size() - 1).end(), mBucket.Size());
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::end() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator Hashmap<TKey, TData, THash, TEquality>::end() const
 	{
-		return ConstIterator(this, this->mBucket.At(mBucket.Size() - 1).begin(), mBucket.Size());
+		return ConstIterator(this, this->mBucket.At(mBucket.Size() - 1).end(), mBucket.Size());
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::cend() const
+	template<typename TKey, typename TData, typename THash, typename TEquality>
+	inline typename Hashmap<TKey, TData, THash, TEquality>::ConstIterator Hashmap<TKey, TData, THash, TEquality>::cend() const
 	{
 		return this->end();
 	}
@@ -4,18 +4,22 @@
 
 #include "DefaultEquality.h"
 #include "DefaultIncrement.h"
+#include "FunctorPolicy.h"
+#include "Memory.h"
 
 namespace Library
 {
 	/// <summary>
-	/// Represents a generic Vector list
+	/// Represents a generic Vector list.
+	/// TIncrement decides how much to grow by when full, the default is a stateless functor the compiler inlines;
+	/// use RuntimeVector to pick the growth strategy at runtime.
 	/// </summary>
-	template <typename T>
+	template <typename T, typename TIncrement = DefaultIncrement<T>>
 	class Vector final
 	{
 	public:
 		using value_type = T;
-		using IncrementFunctor = std::function<size_t(const size_t, const size_t)>;
+		using IncrementFunctor = TIncrement;
 
 		/// <summary>
 		/// Embedded class for Vector for Index traversal
@@ -311,7 +315,7 @@ namespace Library
 		/// <summary>
 		/// Default Constructor
 		/// </summary>
-		Vector(size_t capacity = 0, IncrementFunctor incrementFunctor = DefaultIncrement<T>());
+		Vector(size_t capacity = 0, IncrementFunctor incrementFunctor = DefaultFunctor<IncrementFunctor, DefaultIncrement<T>>());
 		/// <summary>
 		/// Copy Constructor
 		/// </summary>
@@ -340,7 +344,7 @@ namespace Library
 		/// </summary>
 		~Vector();
 
-		Vector(std::initializer_list<T> list, IncrementFunctor incrementFunctor = DefaultIncrement<T>());
+		Vector(std::initializer_list<T> list, IncrementFunctor incrementFunctor = DefaultFunctor<IncrementFunctor, DefaultIncrement<T>>());
 
 #pragma region Constant Time
 		/// <summary>
@@ -516,6 +520,12 @@ namespace Library
 		T* mData{ nullptr };
 		IncrementFunctor mIncrementFunctor;
 	};
+
+	/// <summary>
+	/// Vector whose growth strategy is a std::function, for callers that configure it at runtime
+	/// </summary>
+	template <typename T>
+	using RuntimeVector = Vector<T, IncrementFunction>;
 }
 
 #include "vector.inl"
\ No newline at end of file
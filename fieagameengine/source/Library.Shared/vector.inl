@@ -7,26 +7,26 @@ namespace Library
 {
 #pragma region Iterator
 
-	template<typename T>
-	inline Vector<T>::Iterator::Iterator(Vector<T>* owner, size_t index) :
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::Iterator::Iterator(Vector<T, TIncrement>* owner, size_t index) :
 		mOwner(owner), mIndex(index)
 	{
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::Iterator::operator==(const Iterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return (mOwner == rhs.mOwner) && (mIndex == rhs.mIndex);
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::Iterator::operator!=(const Iterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return !(operator==(rhs));
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::Iterator::operator<(const Iterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::Iterator::operator<(const Iterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -35,8 +35,8 @@ namespace Library
 		return mIndex < rhs.mIndex;
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::Iterator::operator>(const Iterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::Iterator::operator>(const Iterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -45,8 +45,8 @@ namespace Library
 		return mIndex > rhs.mIndex;
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::Iterator::operator<=(const Iterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::Iterator::operator<=(const Iterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -55,8 +55,8 @@ namespace Library
 		return (operator<(rhs)) || (operator==(rhs));
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::Iterator::operator>=(const Iterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::Iterator::operator>=(const Iterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -66,8 +66,8 @@ namespace Library
 	}
 
 	// pre-increment
-	template<typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator& Vector<T, TIncrement>::Iterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -85,8 +85,8 @@ namespace Library
 	}
 
 	// post-increment
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::Iterator::operator++(int)
 	{
 		Iterator temp = *this;
 		operator++();
@@ -94,8 +94,8 @@ namespace Library
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator--()
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator& Vector<T, TIncrement>::Iterator::operator--()
 	{
 		if (mOwner == nullptr)
 		{
@@ -112,8 +112,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator--(int)
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::Iterator::operator--(int)
 	{
 		Iterator temp = *this;
 		operator--();
@@ -121,8 +121,8 @@ namespace Library
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator+(const size_t rhs) 
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::Iterator::operator+(const size_t rhs) 
 	{
 		if ((mIndex + rhs) >= mOwner->mSize)
 		{
@@ -132,8 +132,8 @@ namespace Library
 		return Iterator(mOwner, mIndex + rhs);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator-(const size_t rhs) 
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::Iterator::operator-(const size_t rhs) 
 	{
 		if (mIndex < rhs)
 		{
@@ -143,8 +143,8 @@ namespace Library
 		return Iterator(mOwner, mIndex - rhs);
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Iterator::operator*() const
+	template<typename T, typename TIncrement>
+	inline T& Vector<T, TIncrement>::Iterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -159,8 +159,8 @@ namespace Library
 		return (*mOwner)[mIndex];
 	}
 
-	template<typename T>
-	inline T* Vector<T>::Iterator::operator->() const
+	template<typename T, typename TIncrement>
+	inline T* Vector<T, TIncrement>::Iterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -179,32 +179,32 @@ namespace Library
 
 #pragma region ConstIterator
 
-	template<typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Vector<T>* owner, size_t index) :
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::ConstIterator::ConstIterator(const Vector<T, TIncrement>* owner, size_t index) :
 		mOwner(owner), mIndex(index)
 	{
 	}
 
-	template<typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Iterator& it) :
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::ConstIterator::ConstIterator(const Iterator& it) :
 		mOwner(it.mOwner), mIndex(it.mIndex)
 	{
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::ConstIterator::operator==(const ConstIterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::ConstIterator::operator==(const ConstIterator& rhs) const
 	{
 		return (mOwner == rhs.mOwner) && (mIndex == rhs.mIndex);
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
 		return !(operator==(rhs));
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::ConstIterator::operator<(const ConstIterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::ConstIterator::operator<(const ConstIterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -213,8 +213,8 @@ namespace Library
 		return mIndex < rhs.mIndex;
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::ConstIterator::operator>(const ConstIterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::ConstIterator::operator>(const ConstIterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -223,8 +223,8 @@ namespace Library
 		return mIndex > rhs.mIndex;
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::ConstIterator::operator<=(const ConstIterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::ConstIterator::operator<=(const ConstIterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -233,8 +233,8 @@ namespace Library
 		return (operator<(rhs)) || (operator==(rhs));
 	}
 
-	template<typename T>
-	inline const bool Vector<T>::ConstIterator::operator>=(const ConstIterator& rhs) const
+	template<typename T, typename TIncrement>
+	inline const bool Vector<T, TIncrement>::ConstIterator::operator>=(const ConstIterator& rhs) const
 	{
 		if (mOwner != rhs.mOwner)
 		{
@@ -244,8 +244,8 @@ namespace Library
 	}
 
 	// pre-increment
-	template<typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator++()
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator& Vector<T, TIncrement>::ConstIterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -263,8 +263,8 @@ namespace Library
 	}
 
 	// post-increment
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator++(int)
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp = *this;
 		operator++();
@@ -272,8 +272,8 @@ namespace Library
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator--()
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator& Vector<T, TIncrement>::ConstIterator::operator--()
 	{
 		if (mOwner == nullptr)
 		{
@@ -290,8 +290,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator--(int)
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::ConstIterator::operator--(int)
 	{
 		ConstIterator temp = *this;
 		operator--();
@@ -299,8 +299,8 @@ namespace Library
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator+(const size_t rhs) 
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::ConstIterator::operator+(const size_t rhs) 
 	{
 		if ((mIndex + rhs) >= mOwner->mSize)
 		{
@@ -310,8 +310,8 @@ namespace Library
 		return ConstIterator(mOwner, mIndex + rhs);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator-(const size_t rhs) 
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::ConstIterator::operator-(const size_t rhs) 
 	{
 		if (mIndex < rhs)
 		{
@@ -321,8 +321,8 @@ namespace Library
 		return ConstIterator(mOwner, mIndex - rhs);
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::ConstIterator::operator*() const
+	template<typename T, typename TIncrement>
+	inline const T& Vector<T, TIncrement>::ConstIterator::operator*() const
 	{
 		if (mOwner->IsEmpty())
 		{
@@ -337,8 +337,8 @@ namespace Library
 		return (*mOwner)[mIndex];
 	}
 
-	template<typename T>
-	inline const T* Vector<T>::ConstIterator::operator->() const
+	template<typename T, typename TIncrement>
+	inline const T* Vector<T, TIncrement>::ConstIterator::operator->() const
 	{
 		if (mOwner->IsEmpty())
 		{
@@ -357,15 +357,15 @@ namespace Library
 
 #pragma region Vector
 
-	template<typename T>
-	inline Vector<T>::Vector(size_t capacity, IncrementFunctor incrementFunctor) :
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::Vector(size_t capacity, IncrementFunctor incrementFunctor) :
 		mIncrementFunctor(incrementFunctor)
 	{
 		Reserve(capacity);
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(const Vector<T>& rhs)
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::Vector(const Vector<T, TIncrement>& rhs)
 	{
 		mIncrementFunctor = rhs.mIncrementFunctor;
 
@@ -377,8 +377,8 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(Vector<T>&& rhs) noexcept :
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::Vector(Vector<T, TIncrement>&& rhs) noexcept :
 		mCapacity(rhs.mCapacity), mSize(rhs.mSize), mData(rhs.mData), mIncrementFunctor(rhs.mIncrementFunctor)
 	{
 		rhs.mCapacity = 0;
@@ -386,8 +386,8 @@ namespace Library
 		rhs.mData = nullptr;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(const Vector<T>& rhs)
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>& Vector<T, TIncrement>::operator=(const Vector<T, TIncrement>& rhs)
 	{
 		if (this != &rhs)
 		{
@@ -406,13 +406,13 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(Vector<T>&& rhs) noexcept
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>& Vector<T, TIncrement>::operator=(Vector<T, TIncrement>&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
 			Clear();
-			free (mData);
+			Memory::Free(mData);
 
 			mCapacity = rhs.mCapacity;
 			mSize = rhs.mSize;
@@ -427,15 +427,15 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline Vector<T>::~Vector()
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::~Vector()
 	{
 		Clear();
-		free (mData);
+		Memory::Free(mData);
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(std::initializer_list<T> list, IncrementFunctor incrementFunctor) :
+	template<typename T, typename TIncrement>
+	inline Vector<T, TIncrement>::Vector(std::initializer_list<T> list, IncrementFunctor incrementFunctor) :
 		mCapacity(0), mSize(0), mData(nullptr), mIncrementFunctor(incrementFunctor)
 	{
 		for (const auto& value : list)
@@ -444,8 +444,8 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline T& Vector<T>::operator[](size_t index)
+	template<typename T, typename TIncrement>
+	inline T& Vector<T, TIncrement>::operator[](size_t index)
 	{
 		if (index >= mSize )
 		{
@@ -455,8 +455,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::operator[](size_t index) const
+	template<typename T, typename TIncrement>
+	inline const T& Vector<T, TIncrement>::operator[](size_t index) const
 	{
 		if (index >= mSize)
 		{
@@ -466,8 +466,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline T& Vector<T>::At(size_t index)
+	template<typename T, typename TIncrement>
+	inline T& Vector<T, TIncrement>::At(size_t index)
 	{
 		if (index >= mSize)
 		{
@@ -477,8 +477,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::At(size_t index) const
+	template<typename T, typename TIncrement>
+	inline const T& Vector<T, TIncrement>::At(size_t index) const
 	{
 		if (index >= mSize)
 		{
@@ -488,8 +488,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline void Vector<T>::PopBack()
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::PopBack()
 	{
 		if (!IsEmpty())
 		{
@@ -497,14 +497,14 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline bool Vector<T>::IsEmpty() const
+	template<typename T, typename TIncrement>
+	inline bool Vector<T, TIncrement>::IsEmpty() const
 	{
 		return mSize == 0;
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Front()
+	template<typename T, typename TIncrement>
+	inline T& Vector<T, TIncrement>::Front()
 	{
 		if (IsEmpty())
 		{
@@ -513,8 +513,8 @@ namespace Library
 		return *mData;
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Front() const
+	template<typename T, typename TIncrement>
+	inline const T& Vector<T, TIncrement>::Front() const
 	{
 		if (IsEmpty())
 		{
@@ -523,8 +523,8 @@ namespace Library
 		return *mData;
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Back()
+	template<typename T, typename TIncrement>
+	inline T& Vector<T, TIncrement>::Back()
 	{
 		if (IsEmpty())
 		{
@@ -533,8 +533,8 @@ namespace Library
 		return mData[mSize-1];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Back() const
+	template<typename T, typename TIncrement>
+	inline const T& Vector<T, TIncrement>::Back() const
 	{
 		if (IsEmpty())
 		{
@@ -543,56 +543,56 @@ namespace Library
 		return mData[mSize-1];
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Size() const
+	template<typename T, typename TIncrement>
+	inline size_t Vector<T, TIncrement>::Size() const
 	{
 		return mSize;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Capacity() const
+	template<typename T, typename TIncrement>
+	inline size_t Vector<T, TIncrement>::Capacity() const
 	{
 		return mCapacity;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::begin()
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::begin()
 	{
 		return Iterator(this, 0);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::begin() const
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::begin() const
 	{
 		return ConstIterator(this, 0);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cbegin() const
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::cbegin() const
 	{
 		return ConstIterator(this, 0);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::end()
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::end()
 	{
 		return Iterator(this, mSize);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::end() const
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::end() const
 	{
 		return ConstIterator(this, mSize);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cend() const
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::cend() const
 	{
 		return ConstIterator(this, mSize);
 	}
 
-	template<typename T>
-	inline void Vector<T>::PushBack(const T& data)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::PushBack(const T& data)
 	{
 		if (mSize == mCapacity)
 		{
@@ -603,8 +603,8 @@ namespace Library
 		++mSize;
 	}
 
-	template<typename T>
-	inline void Vector<T>::PushBack(T&& data)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::PushBack(T&& data)
 	{
 		if (mSize == mCapacity)
 		{
@@ -615,21 +615,21 @@ namespace Library
 		++mSize;
 	}
 
-	template<typename T>
-	inline void Vector<T>::Reserve(const size_t capacity)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::Reserve(const size_t capacity)
 	{
 		if (capacity > mCapacity)
 		{
 			mCapacity = capacity;
 
-			T* data = reinterpret_cast<T*>(realloc(mData, mCapacity * sizeof(T)));
+			T* data = reinterpret_cast<T*>(Memory::Reallocate(mData, mCapacity * sizeof(T)));
 			assert(data != nullptr);
 			mData = data;
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::Resize(const size_t size)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::Resize(const size_t size)
 	{
 		if (size < mSize)
 		{
@@ -655,18 +655,18 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::ShrinkToFit()
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::ShrinkToFit()
 	{
 		if (mSize < mCapacity)
 		{
-			mData = reinterpret_cast<T*>(realloc(mData, sizeof(T) * mSize));			
+			mData = reinterpret_cast<T*>(Memory::Reallocate(mData, sizeof(T) * mSize));			
 			mCapacity = mSize;
 		}
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Find(const T& value)
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::Iterator Vector<T, TIncrement>::Find(const T& value)
 	{
 		Iterator it = begin();
 		for (; it != end(); it++)
@@ -676,8 +676,8 @@ namespace Library
 		return it;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::Find(const T& value) const
+	template<typename T, typename TIncrement>
+	inline typename Vector<T, TIncrement>::ConstIterator Vector<T, TIncrement>::Find(const T& value) const
 	{
 		ConstIterator it = begin();
 		for (; it != end(); it++)
@@ -687,8 +687,8 @@ namespace Library
 		return it;
 	}
 
-	template<typename T>
-	inline void Vector<T>::Clear()
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::Clear()
 	{
 		while (!IsEmpty())
 		{
@@ -696,15 +696,15 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::Remove(const T& value)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::Remove(const T& value)
 	{
 		auto it = Find(value);
 		if(it != end()) Remove(it);
 	}
 
-	template<typename T>
-	inline void Vector<T>::Remove(const Iterator& it)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::Remove(const Iterator& it)
 	{
 		if (it.mOwner != this)
 		{
@@ -714,8 +714,8 @@ namespace Library
 		if (it < end()) Remove(it, it);
 	}
 
-	template<typename T>
-	inline void Vector<T>::Remove(const Iterator& first, const Iterator& last)
+	template<typename T, typename TIncrement>
+	inline void Vector<T, TIncrement>::Remove(const Iterator& first, const Iterator& last)
 	{
 		if ((first.mOwner != this) || (last.mOwner != this) || (first.mOwner != last.mOwner))
 		{
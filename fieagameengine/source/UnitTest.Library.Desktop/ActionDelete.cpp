@@ -0,0 +1,40 @@
+#include "pch.h"
+#include "ActionDelete.h"
+
+namespace Library
+{
+	RTTI_DEFINITIONS(ActionDelete)
+
+	ActionDelete::ActionDelete() :
+		Action(TypeIdClass(), std::string())
+	{
+	}
+
+	ActionDelete::ActionDelete(const std::string& name) :
+		Action(TypeIdClass(), name)
+	{
+	}
+
+	void ActionDelete::Update(WorldState& worldState)
+	{
+		worldState.action = this;
+
+		delete mTarget;
+		mTarget = nullptr;
+	}
+
+	void ActionDelete::SetTarget(Scope* target)
+	{
+		mTarget = target;
+	}
+
+	Vector<Signature> ActionDelete::Signatures()
+	{
+		return Action::Signatures();
+	}
+
+	gsl::owner<Scope*> ActionDelete::Clone() const
+	{
+		return new ActionDelete(*this);
+	}
+}
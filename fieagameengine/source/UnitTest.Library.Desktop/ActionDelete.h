@@ -0,0 +1,35 @@
+#pragma once
+#include "Action.h"
+#include "Factory.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Deletes the scope it is given the first time it runs, so tests can destroy a scope from inside an update or a reaction
+	/// </summary>
+	class ActionDelete final : public Action
+	{
+		RTTI_DECLARATIONS(ActionDelete, Action)
+	public:
+		ActionDelete();
+		explicit ActionDelete(const std::string& name);
+		ActionDelete(const ActionDelete& rhs) = default;
+		ActionDelete(ActionDelete&& rhs) = default;
+		ActionDelete& operator=(const ActionDelete& rhs) = default;
+		ActionDelete& operator=(ActionDelete&& rhs) = default;
+		virtual ~ActionDelete() = default;
+
+		virtual void Update(WorldState& worldState) override;
+
+		void SetTarget(Scope* target);
+
+		static Vector<Signature> Signatures();
+
+		virtual gsl::owner<Scope*> Clone() const override;
+
+	private:
+		Scope* mTarget{ nullptr };
+	};
+
+	ConcreteFactory(ActionDelete, Scope)
+}
@@ -0,0 +1,44 @@
+#include "pch.h"
+#include "ActionEmit.h"
+#include "Particle.h"
+#include "Sector.h"
+#include "World.h"
+#include "WorldState.h"
+
+namespace Library
+{
+	RTTI_DEFINITIONS(ActionEmit)
+
+	ActionEmit::ActionEmit() :
+		Action(TypeIdClass(), std::string())
+	{
+	}
+
+	ActionEmit::ActionEmit(const std::string& name) :
+		Action(TypeIdClass(), name)
+	{
+	}
+
+	void ActionEmit::Update(WorldState& worldState)
+	{
+		worldState.action = this;
+
+		static const Symbol positionKey("Position");
+		static const Symbol velocityKey("Velocity");
+
+		Entity& entity = *GetParent()->As<Entity>();
+		entity.Find(positionKey)->Get<glm::vec4>() += entity.Find(velocityKey)->Get<glm::vec4>();
+
+		worldState.world->Spawn(*entity.GetSector(), Particle::TypeName(), "Emitted");
+	}
+
+	Vector<Signature> ActionEmit::Signatures()
+	{
+		return Action::Signatures();
+	}
+
+	gsl::owner<Scope*> ActionEmit::Clone() const
+	{
+		return new ActionEmit(*this);
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "Action.h"
+#include "Factory.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Moves its entity's pooled Position by its Velocity, then spawns a Particle into the sector through the world,
+	/// so tests can create pooled instances from inside the jobs of a parallel update
+	/// </summary>
+	class ActionEmit final : public Action
+	{
+		RTTI_DECLARATIONS(ActionEmit, Action)
+	public:
+		ActionEmit();
+		explicit ActionEmit(const std::string& name);
+		ActionEmit(const ActionEmit& rhs) = default;
+		ActionEmit(ActionEmit&& rhs) = default;
+		ActionEmit& operator=(const ActionEmit& rhs) = default;
+		ActionEmit& operator=(ActionEmit&& rhs) = default;
+		virtual ~ActionEmit() = default;
+
+		virtual void Update(WorldState& worldState) override;
+
+		static Vector<Signature> Signatures();
+
+		virtual gsl::owner<Scope*> Clone() const override;
+	};
+
+	ConcreteFactory(ActionEmit, Scope)
+}
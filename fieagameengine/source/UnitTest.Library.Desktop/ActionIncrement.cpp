@@ -19,7 +19,8 @@ namespace Library
 	{
 		worldState.action = this;
 
-		Datum& datum = *((*this).Find("Target"));
+		static const Symbol targetKey("Target");
+		const Datum& datum = *FindArgument(targetKey);
 		Datum* target = Search(datum.Get<std::string>());
 
 		if (nullptr != target && (Datum::DatumTypes::Integer == target->Type()))
@@ -0,0 +1,38 @@
+#include "pch.h"
+#include "ActionRecord.h"
+#include "Entity.h"
+#include "Sector.h"
+
+namespace Library
+{
+	RTTI_DEFINITIONS(ActionRecord)
+
+	ActionRecord::ActionRecord() :
+		Action(TypeIdClass(), std::string())
+	{
+	}
+
+	ActionRecord::ActionRecord(const std::string& name) :
+		Action(TypeIdClass(), name)
+	{
+	}
+
+	void ActionRecord::Update(WorldState& worldState)
+	{
+		worldState.action = this;
+
+		Datum* count = Search("Count");
+		const std::int32_t value = (count != nullptr ? count->Get<std::int32_t>() : 0);
+		(*worldState.sector)["Log"].PushBack(worldState.entity->Name() + ":" + std::to_string(value));
+	}
+
+	Vector<Signature> ActionRecord::Signatures()
+	{
+		return Action::Signatures();
+	}
+
+	gsl::owner<Scope*> ActionRecord::Clone() const
+	{
+		return new ActionRecord(*this);
+	}
+}
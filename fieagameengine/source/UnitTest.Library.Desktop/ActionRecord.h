@@ -0,0 +1,30 @@
+#pragma once
+#include "Action.h"
+#include "Factory.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Appends "entity name:Count" to the sector's "Log" attribute, so tests can see in which order actions ran
+	/// </summary>
+	class ActionRecord final : public Action
+	{
+		RTTI_DECLARATIONS(ActionRecord, Action)
+	public:
+		ActionRecord();
+		explicit ActionRecord(const std::string& name);
+		ActionRecord(const ActionRecord& rhs) = default;
+		ActionRecord(ActionRecord&& rhs) = default;
+		ActionRecord& operator=(const ActionRecord& rhs) = default;
+		ActionRecord& operator=(ActionRecord&& rhs) = default;
+		virtual ~ActionRecord() = default;
+
+		virtual void Update(WorldState& worldState) override;
+
+		static Vector<Signature> Signatures();
+
+		virtual gsl::owner<Scope*> Clone() const override;
+	};
+
+	ConcreteFactory(ActionRecord, Scope)
+}
@@ -123,6 +123,76 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual("TestActionDestroyAction"s, actionDestroyAction2.Name());
 		}
 
+		TEST_METHOD(TypeDescriptorTest)
+		{
+			const TypeManager::TypeDescriptor& descriptor = TypeManager::GetDescriptor(ActionIncrement::TypeIdClass());
+			Assert::AreEqual(ActionIncrement::Signatures().Size() + 1, descriptor.PrescribedCount());
+			Assert::AreEqual(descriptor.Signatures().Size(), descriptor.Names().Size());
+			Assert::IsTrue(&descriptor.Signatures() == &TypeManager::GetSignatures(ActionIncrement::TypeIdClass()));
+
+			// registering again keeps the descriptor that is already there
+			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures());
+			Assert::IsTrue(&descriptor == &TypeManager::GetDescriptor(ActionIncrement::TypeIdClass()));
+
+			Assert::IsTrue(descriptor.IsPrescribed(Symbol("this")));
+			Assert::IsTrue(descriptor.IsPrescribed(Symbol("Name")));
+			Assert::IsTrue(descriptor.IsPrescribed(Symbol("Target")));
+			Assert::IsFalse(descriptor.IsPrescribed(Symbol("Number")));
+			Assert::IsFalse(descriptor.IsPrescribed(Symbol()));
+
+			// the index of a prescribed attribute is where every instance keeps it
+			ActionIncrement actionIncrement;
+			actionIncrement.AppendAuxiliaryAttribute("Number") = 1;
+			const auto& attributes = actionIncrement.GetAttributes();
+			Assert::AreEqual(0_z, descriptor.IndexOf(Symbol("this")));
+			Assert::IsTrue(attributes[descriptor.IndexOf(Symbol("Target"))]->first == Symbol("Target"));
+			Assert::AreEqual(descriptor.PrescribedCount(), descriptor.IndexOf(Symbol("Number")));
+
+			Assert::IsTrue(actionIncrement.IsPrescribedAttribute(Symbol("Target")));
+			Assert::IsFalse(actionIncrement.IsPrescribedAttribute("Number"s));
+			Assert::IsFalse(actionIncrement.IsPrescribedAttribute("NeverInternedAttributeName"s));
+			Assert::IsTrue(actionIncrement.IsAuxiliaryAttribute("Number"s));
+			Assert::AreEqual(descriptor.PrescribedCount(), actionIncrement.GetPrescribedAttributes().Size());
+			Assert::AreEqual(1_z, actionIncrement.GetAuxiliaryAttributes().Size());
+
+			auto expression = [&actionIncrement] { actionIncrement.AppendAuxiliaryAttribute("Target"); };
+			Assert::ExpectException<std::exception>(expression);
+		}
+
+		TEST_METHOD(PrototypeTest)
+		{
+			const TypeManager::TypeDescriptor& descriptor = TypeManager::GetDescriptor(ActionIf::TypeIdClass());
+			const Scope& prototype = descriptor.Prototype();
+			Assert::AreEqual(descriptor.PrescribedCount(), prototype.Size());
+			for (std::size_t i = 0; i < descriptor.Signatures().Size(); ++i)
+			{
+				const Datum* datum = prototype.Find(descriptor.Names()[i]);
+				Assert::IsNotNull(datum);
+				Assert::IsTrue(descriptor.Signatures()[i].mType == datum->Type());
+				Assert::AreEqual(0_z, datum->Size());
+			}
+
+			// every instance points the prototype's datums at its own members
+			ActionIf actionIf("TestActionIf");
+			ActionIf otherActionIf("OtherActionIf");
+			Assert::AreEqual(descriptor.PrescribedCount(), actionIf.Size());
+			Assert::IsTrue(&actionIf == actionIf["this"].Get<Scope*>());
+			Assert::AreEqual("TestActionIf"s, actionIf["Name"].Get<std::string>());
+			Assert::AreEqual("OtherActionIf"s, otherActionIf["Name"].Get<std::string>());
+
+			actionIf.SetCondition(1);
+			otherActionIf.SetCondition(0);
+			Assert::AreEqual(1, actionIf["Condition"].Get<std::int32_t>());
+			Assert::AreEqual(0, otherActionIf["Condition"].Get<std::int32_t>());
+			Assert::AreEqual(0_z, prototype.Find(Symbol("Condition"))->Size());
+
+			ActionIncrement* increment = new ActionIncrement("Increment");
+			actionIf.SetIfBlock(*increment);
+			Assert::AreEqual(1_z, actionIf["ThenAction"].Size());
+			Assert::AreEqual(0_z, otherActionIf["ThenAction"].Size());
+			Assert::AreEqual(0_z, prototype.Find(Symbol("ThenAction"))->Size());
+		}
+
 		TEST_METHOD(UpdateTest)
 		{
 			GameTime gameTime;
@@ -278,6 +348,13 @@ namespace UnitTestLibraryDesktop
 
 				world.Update(worldState);
 				Assert::AreEqual(0_z, TestActionList->Actions().Size());
+
+				// the destroyed action went back to its factory, the next one created reuses it
+				Assert::AreEqual(1_z, actionDestroyActionFactory.PoolSize());
+				Action* recycled = TestActionList->CreateAction("ActionDestroyAction", "RecycledActionDestroyAction");
+				Assert::IsTrue(recycled == TestActionDestroyAction);
+				Assert::AreEqual("RecycledActionDestroyAction"s, recycled->Name());
+				Assert::AreEqual(0_z, actionDestroyActionFactory.PoolSize());
 			}
 
 		}
@@ -0,0 +1,226 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Arena.h"
+#include "Memory.h"
+#include "JsonTableParseHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ArenaTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Allocate)
+		{
+			Arena arena(256);
+			Assert::AreEqual(0_z, arena.BlockCount());
+			Assert::AreEqual(0_z, arena.BytesUsed());
+
+			void* first = arena.Allocate(3, 1);
+			void* second = arena.Allocate(8);
+			Assert::AreEqual(1_z, arena.BlockCount());
+			Assert::AreEqual(11_z, arena.BytesUsed());
+			Assert::AreEqual(0_z, reinterpret_cast<std::uintptr_t>(second) % Arena::MaxAlignment);
+			Assert::IsTrue(arena.Owns(first));
+			Assert::IsTrue(arena.Owns(second));
+
+			int local = 0;
+			Assert::IsFalse(arena.Owns(&local));
+
+			// larger than a block, gets a block of its own
+			void* large = arena.Allocate(1000);
+			Assert::AreEqual(2_z, arena.BlockCount());
+			Assert::IsTrue(arena.Owns(large));
+		}
+
+		TEST_METHOD(Reallocate)
+		{
+			Arena arena(256);
+
+			char* data = static_cast<char*>(arena.Allocate(16));
+			data[0] = 'a';
+			Assert::IsTrue(data == arena.Reallocate(data, 16, 64));
+			Assert::AreEqual(64_z, arena.BytesUsed());
+
+			arena.Allocate(8);
+			char* moved = static_cast<char*>(arena.Reallocate(data, 64, 128));
+			Assert::IsTrue(data != moved);
+			Assert::AreEqual('a', moved[0]);
+
+			char* fresh = static_cast<char*>(arena.Reallocate(nullptr, 0, 8));
+			Assert::IsTrue(arena.Owns(fresh));
+		}
+
+		TEST_METHOD(Reset)
+		{
+			Arena arena(256);
+			arena.Allocate(200);
+			arena.Allocate(200);
+			Assert::AreEqual(2_z, arena.BlockCount());
+
+			arena.Reset();
+			Assert::AreEqual(1_z, arena.BlockCount());
+			Assert::AreEqual(0_z, arena.BytesUsed());
+
+			void* data = arena.Allocate(100);
+			Assert::IsTrue(arena.Owns(data));
+			Assert::AreEqual(1_z, arena.BlockCount());
+		}
+
+		TEST_METHOD(Guard)
+		{
+			Arena arena;
+			Assert::IsNull(Arena::Current());
+
+			Vector<int> heapList;
+			{
+				Arena::Guard guard(&arena);
+				Assert::IsTrue(Arena::Current() == &arena);
+
+				Vector<int> arenaList;
+				SList<int> arenaNodes;
+				for (int i = 0; i < 100; ++i)
+				{
+					arenaList.PushBack(i);
+					arenaNodes.PushBack(i);
+				}
+				Assert::IsTrue(arena.Owns(&arenaList[0]));
+				Assert::IsTrue(arena.Owns(&arenaNodes.Front()));
+
+				{
+					Arena::Guard heap(nullptr);
+					Assert::IsNull(Arena::Current());
+					heapList.PushBack(1);
+				}
+				Assert::IsTrue(Arena::Current() == &arena);
+				Assert::IsFalse(arena.Owns(&heapList[0]));
+			}
+			Assert::IsNull(Arena::Current());
+
+			// arena memory keeps working once the guard is gone, the heap list still goes back to the heap
+			heapList.PushBack(2);
+			Assert::AreEqual(2, heapList[1]);
+			Assert::IsTrue(arena.BytesUsed() > 0);
+		}
+
+		TEST_METHOD(GrowOutsideGuard)
+		{
+			Arena arena;
+
+			Vector<int> list;
+			{
+				Arena::Guard guard(&arena);
+				for (int i = 0; i < 10; ++i)
+				{
+					list.PushBack(i);
+				}
+			}
+			Assert::IsTrue(arena.Owns(&list[0]));
+
+			// grown once the build is over, the values move to the heap and the arena is left alone
+			const std::size_t used = arena.BytesUsed();
+			for (int i = 10; i < 1000; ++i)
+			{
+				list.PushBack(i);
+			}
+			Assert::IsFalse(arena.Owns(&list[0]));
+			Assert::AreEqual(used, arena.BytesUsed());
+			for (int i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(i, list[i]);
+			}
+
+			// grown under another arena's guard, it does not go in that one either
+			Arena other;
+			{
+				Arena::Guard guard(&other);
+				Vector<int> otherList;
+				otherList.PushBack(1);
+				Assert::IsTrue(other.Owns(&otherList[0]));
+
+				list.ShrinkToFit();
+				list.PushBack(1000);
+				Assert::IsFalse(other.Owns(&list[0]));
+			}
+
+			// untracked data outlives any arena
+			{
+				Arena::Guard guard(&arena);
+				Memory::UntrackedGuard untracked;
+				void* data = Memory::Allocate(16);
+				Assert::IsFalse(arena.Owns(data));
+				Memory::Free(data);
+			}
+		}
+
+		TEST_METHOD(ParseIntoArena)
+		{
+			const std::string fileName = "Content\\JsonParseTableTest.json";
+
+			Scope heapScope;
+			{
+				JsonTableParseHelper tableParseHelper;
+				JsonTableParseHelper::SharedData tableSharedData(heapScope);
+				JsonParseMaster parseMaster(tableSharedData);
+				parseMaster.AddHelper(tableParseHelper);
+				parseMaster.Initialize();
+				parseMaster.ParseFromFile(fileName);
+			}
+
+			// the arena is declared first, so the tree is torn down before its blocks are released
+			Arena arena;
+			Scope arenaScope;
+			{
+				JsonTableParseHelper tableParseHelper;
+				JsonTableParseHelper::SharedData tableSharedData(arenaScope);
+				tableSharedData.SetArena(&arena);
+				Assert::IsTrue(tableSharedData.GetArena() == &arena);
+
+				JsonParseMaster parseMaster(tableSharedData);
+				parseMaster.AddHelper(tableParseHelper);
+				parseMaster.Initialize();
+				parseMaster.ParseFromFile(fileName);
+			}
+			Assert::IsNull(Arena::Current());
+
+			Assert::IsTrue(arena.BytesUsed() > 0);
+			Assert::IsTrue(arena.Owns(arenaScope.Find("IntegerArrayTest")));
+			Assert::IsFalse(arena.Owns(heapScope.Find("IntegerArrayTest")));
+			// Scope::operator== compares attribute addresses, so compare the two trees by content
+			Assert::AreEqual(heapScope.Size(), arenaScope.Size());
+			Assert::AreEqual(heapScope["IntegerArrayTest"].Size(), arenaScope["IntegerArrayTest"].Size());
+			Assert::AreEqual(heapScope["IntegerArrayTest"].Get<std::int32_t>(1), arenaScope["IntegerArrayTest"].Get<std::int32_t>(1));
+			Assert::AreEqual(321, arenaScope["IntegerArrayTest"].Get<std::int32_t>(1));
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ArenaTests::sStartMemState;
+}
@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "DefaultHash.h"
+#include "hashmap.h"
+#include "json/json.h"
+#include <fstream>
+#include <chrono>
 #include "Foo.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -95,6 +99,30 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(hashFunc(a), hashFunc(c));
 		}
 
+		TEST_METHOD(Pointer)
+		{
+			// neighbouring addresses differ in a few low bits only, they still spread over the buckets
+			Vector<std::uint64_t> values(1024);
+			values.Resize(1024);
+			DefaultHash<const std::uint64_t*> hashFunc;
+			DefaultHash<std::uint64_t* const> constHashFunc;
+
+			const std::size_t bucketCount = 64;
+			Vector<std::size_t> buckets(bucketCount);
+			buckets.Resize(bucketCount);
+			for (std::uint64_t& value : values)
+			{
+				Assert::AreEqual(hashFunc(&value), constHashFunc(&value));
+				++buckets[hashFunc(&value) % bucketCount];
+			}
+			Assert::AreNotEqual(hashFunc(&values[0]), hashFunc(&values[1]));
+
+			for (std::size_t count : buckets)
+			{
+				Assert::IsTrue(count > 0 && count < 64);
+			}
+		}
+
 		TEST_METHOD(String)
 		{
 			std::string a = "Hello";
@@ -119,7 +147,158 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(hashFunc(a), hashFunc(c));
 		}
 
+		TEST_METHOD(Anagrams)
+		{
+			DefaultHash<std::string> hashFunc;
+			Assert::AreNotEqual(hashFunc("name"s), hashFunc("mane"s));
+			Assert::AreNotEqual(hashFunc("name"s), hashFunc("amen"s));
+			Assert::AreNotEqual(hashFunc("mane"s), hashFunc("amen"s));
+
+			// the additive hash this replaced could not tell these apart
+			const std::string name = "name";
+			const std::string mane = "mane";
+			Assert::AreEqual(AdditiveHash(reinterpret_cast<const std::uint8_t*>(name.c_str()), name.length()), AdditiveHash(reinterpret_cast<const std::uint8_t*>(mane.c_str()), mane.length()));
+		}
+
+		TEST_METHOD(LongKeys)
+		{
+			// crosses the striped (SIMD) path boundary and several scramble blocks
+			std::string key(5000, 'a');
+			for (std::size_t i = 0; i < key.length(); ++i)
+			{
+				key[i] = static_cast<char>('a' + (i * 7) % 26);
+			}
+
+			DefaultHash<std::string> hashFunc;
+			for (std::size_t length : { 255_z, 256_z, 1024_z, 1025_z, 5000_z })
+			{
+				std::string longKey = key.substr(0, length);
+				std::string copy(longKey);
+				Assert::AreEqual(hashFunc(longKey), hashFunc(copy));
+
+				copy[length / 2] ^= 1;
+				Assert::AreNotEqual(hashFunc(longKey), hashFunc(copy));
+			}
+		}
+
+		TEST_METHOD(SimdMatchesScalar)
+		{
+			// the default striped path (SSE2 where available) and the scalar one give every key the same hash,
+			// around the long key, stripe and block boundaries, from aligned and unaligned starts
+			std::string bytes(4200, '\0');
+			std::uint32_t state = 12345;
+			for (char& byte : bytes)
+			{
+				state = state * 1664525u + 1013904223u;
+				byte = static_cast<char>(state >> 24);
+			}
+
+			for (std::size_t offset = 0; offset < 4; ++offset)
+			{
+				const std::uint8_t* key = reinterpret_cast<const std::uint8_t*>(bytes.data()) + offset;
+				for (std::size_t boundary : { 256_z, 320_z, 1024_z, 2048_z, 4096_z })
+				{
+					for (std::size_t length = boundary - 2; length <= boundary + 2; ++length)
+					{
+						Assert::AreEqual(HashHelpers::LongHash<HashHelpers::AccumulateStripesScalar>(key, length), HashHelpers::LongHash(key, length));
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(CollisionBenchmark)
+		{
+			const std::string fileNames[] = { "Content\\ActionTest.json", "Content\\EntityTest.json", "Content\\JsonParseTableTest.json",
+				"Content\\ReactionTest.json", "Content\\SectorTest.json", "Content\\WorldTest.json" };
+
+			Vector<std::string> keys;
+			for (const std::string& fileName : fileNames)
+			{
+				std::ifstream file(fileName);
+				Assert::IsTrue(file.good());
+
+				Json::Value root;
+				file >> root;
+				CollectKeys(root, keys);
+			}
+			Assert::IsTrue(keys.Size() > 0);
+
+			const auto additive = [](const std::string& key) { return AdditiveHash(reinterpret_cast<const std::uint8_t*>(key.c_str()), key.length()); };
+			const auto [additiveCollisions, additiveLongestChain, additiveTime] = MeasureHash(keys, additive);
+			const auto [collisions, longestChain, hashTime] = MeasureHash(keys, DefaultHash<std::string>());
+
+			Logger::WriteMessage(("attribute names: " + std::to_string(keys.Size()) + "\n").c_str());
+			Logger::WriteMessage(("AdditiveHash: " + std::to_string(additiveCollisions) + " full collisions, longest chain " + std::to_string(additiveLongestChain)
+				+ " of 31 buckets, " + std::to_string(additiveTime) + "us\n").c_str());
+			Logger::WriteMessage(("StringHash:   " + std::to_string(collisions) + " full collisions, longest chain " + std::to_string(longestChain)
+				+ " of 31 buckets, " + std::to_string(hashTime) + "us\n").c_str());
+
+			Assert::AreEqual(0_z, collisions);
+			Assert::IsTrue(collisions <= additiveCollisions);
+		}
+
 	private:
+		/// <summary>
+		/// Gathers every member name in the document, the same strings that end up as Scope attribute names
+		/// </summary>
+		static void CollectKeys(const Json::Value& value, Vector<std::string>& keys)
+		{
+			if (value.isObject())
+			{
+				for (const std::string& key : value.getMemberNames())
+				{
+					if (keys.Find(key) == keys.end())
+					{
+						keys.PushBack(key);
+					}
+					CollectKeys(value[key], keys);
+				}
+			}
+			else if (value.isArray())
+			{
+				for (const Json::Value& element : value)
+				{
+					CollectKeys(element, keys);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Returns the number of distinct keys sharing a full hash, the longest chain in a 31 bucket Hashmap
+		/// and the microseconds spent hashing the corpus 10000 times
+		/// </summary>
+		static std::tuple<std::size_t, std::size_t, long long> MeasureHash(const Vector<std::string>& keys, RuntimeHashmap<std::string, int>::HashFunctor hashFunctor)
+		{
+			Hashmap<std::size_t, int> hashes;
+			RuntimeHashmap<std::string, int> buckets(31, hashFunctor);
+			buckets.SetMaxLoadFactor(static_cast<float>(keys.Size()));
+
+			std::size_t collisions = 0;
+			for (const std::string& key : keys)
+			{
+				auto [it, isInserted] = hashes.Insert(std::pair<std::size_t, int>(hashFunctor(key), 0));
+				if (!isInserted)
+				{
+					++collisions;
+				}
+				buckets.Insert(std::pair<std::string, int>(key, 0));
+			}
+
+			std::size_t sink = 0;
+			const auto start = std::chrono::high_resolution_clock::now();
+			for (std::size_t i = 0; i < 10000; ++i)
+			{
+				for (const std::string& key : keys)
+				{
+					sink += hashFunctor(key);
+				}
+			}
+			const auto end = std::chrono::high_resolution_clock::now();
+			Assert::IsTrue(sink != 1);
+
+			return { collisions, buckets.LongestChain(), std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() };
+		}
+
 		static _CrtMemState sStartMemState;
 	};
 
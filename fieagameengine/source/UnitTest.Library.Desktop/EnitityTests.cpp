@@ -5,8 +5,10 @@
 #include "Factory.h"
 #include "JsonTableParseHelper.h"
 #include <fstream>
+#include <thread>
 #include "Foo.h"
 #include "DerivedFoo.h"
+#include "Particle.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -49,6 +51,7 @@ namespace UnitTestLibraryDesktop
 		{
 			TypeManager::RegisterType(Entity::TypeIdClass(), Entity::Signatures());
 			TypeManager::RegisterType(Sector::TypeIdClass(), Sector::Signatures());
+			TypeManager::RegisterType(Particle::TypeIdClass(), Particle::Signatures());
 			
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -174,6 +177,126 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(123, entity["A"].Get<std::int32_t>());
 		}
 
+		TEST_METHOD(PooledAttributesTest)
+		{
+			ParticleFactory particleFactory;
+			AttributePool& pool = TypeManager::GetPool(Particle::TypeIdClass());
+			Assert::AreEqual(3_z, pool.ColumnCount());
+			const size_t position = pool.ColumnIndex(Symbol("Position"));
+			const size_t velocity = pool.ColumnIndex(Symbol("Velocity"));
+			Assert::AreEqual(pool.ColumnCount(), pool.ColumnIndex(Symbol("Name")));
+			Assert::IsTrue(Datum::DatumTypes::Vector == pool.ColumnType(position));
+
+			// more particles than the pool first reserves, the rows move while it grows
+			const size_t count = 40;
+			Sector sector;
+			for (size_t i = 0; i < count; ++i)
+			{
+				Entity* particle = sector.CreateEntity("Particle", "Particle" + to_string(i));
+				(*particle)["Velocity"].Set(glm::vec4(static_cast<float>(i), 0, 0, 0));
+				(*particle)["Tag"].Set("Tag" + to_string(i));
+			}
+			Assert::AreEqual(count, pool.Size());
+
+			// a system walks the columns linearly, the Scope side sees the result
+			glm::vec4* positions = pool.Column<glm::vec4>(position);
+			const glm::vec4* velocities = pool.Column<glm::vec4>(velocity);
+			for (size_t row = 0; row < pool.Size(); ++row)
+			{
+				positions[row] += velocities[row];
+			}
+
+			Datum& entities = sector.Entities();
+			for (size_t i = 0; i < count; ++i)
+			{
+				Scope& particle = entities[i];
+				Assert::IsTrue(glm::vec4(static_cast<float>(i), 0, 0, 0) == particle["Position"].Get<glm::vec4>());
+				Assert::AreEqual("Tag" + to_string(i), particle["Tag"].Get<std::string>());
+			}
+
+			// destroying a particle moves the last row into its place
+			delete entities.Get<Scope*>(0);
+			Assert::AreEqual(count - 1, pool.Size());
+			for (size_t i = 0; i < count - 1; ++i)
+			{
+				Scope& particle = entities[i];
+				Assert::IsTrue(glm::vec4(static_cast<float>(i + 1), 0, 0, 0) == particle["Position"].Get<glm::vec4>());
+				Assert::AreEqual("Tag" + to_string(i + 1), particle["Tag"].Get<std::string>());
+			}
+
+			{
+				// a copy gets a row of its own, a move takes the row along
+				Particle& original = *entities.Get<Scope*>(0)->As<Particle>();
+				Particle copy(original);
+				Assert::AreEqual(count, pool.Size());
+				Assert::AreEqual("Tag1"s, copy["Tag"].Get<std::string>());
+				copy["Tag"].Set("Copy"s);
+				Assert::AreEqual("Tag1"s, original["Tag"].Get<std::string>());
+
+				Particle moved(std::move(copy));
+				Assert::AreEqual(count, pool.Size());
+				Assert::AreEqual("Copy"s, moved["Tag"].Get<std::string>());
+
+				Particle assigned;
+				assigned = original;
+				Assert::AreEqual(count + 1, pool.Size());
+				Assert::AreEqual("Tag1"s, assigned["Tag"].Get<std::string>());
+				Assert::IsTrue(&pool.Owner(count) == &assigned);
+			}
+			Assert::AreEqual(count - 1, pool.Size());
+		}
+
+		TEST_METHOD(PooledAttributesThreadsTest)
+		{
+			AttributePool& pool = TypeManager::GetPool(Particle::TypeIdClass());
+			const size_t position = pool.ColumnIndex(Symbol("Position"));
+
+			// particles made and destroyed on several threads at once, the rows stay dense and every instance keeps its own
+			const size_t threadCount = 4;
+			const size_t count = 200;
+			Vector<Particle*> kept[threadCount];
+			Vector<thread*> threads;
+			for (size_t t = 0; t < threadCount; ++t)
+			{
+				threads.PushBack(new thread([&kept, t]
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						Particle* particle = new Particle();
+						if (i % 2 == 0)
+						{
+							kept[t].PushBack(particle);
+						}
+						else
+						{
+							delete particle;
+						}
+					}
+				}));
+			}
+			for (thread* t : threads)
+			{
+				t->join();
+				delete t;
+			}
+
+			Assert::AreEqual(threadCount * count / 2, pool.Size());
+			const glm::vec4* positions = pool.Column<glm::vec4>(position);
+			for (size_t row = 0; row < pool.Size(); ++row)
+			{
+				Assert::IsTrue(&pool.Owner(row)["Position"].Get<glm::vec4>() == positions + row);
+			}
+
+			for (Vector<Particle*>& particles : kept)
+			{
+				for (Particle* particle : particles)
+				{
+					delete particle;
+				}
+			}
+			Assert::IsTrue(pool.IsEmpty());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -8,12 +8,18 @@
 #include "SubscriberFooEnque.h"
 #include "SubscriberFooSubNewFoo.h"
 #include "SubscriberFooUnsubSelf.h"
+#include "SubscriberFooBatch.h"
+#include "SubscriberFooThrow.h"
 #include "Factory.h"
 #include "Foo.h"
 #include "Bar.h"
 #include "GameTime.h"
+#include "JobSystem.h"
+#include <atomic>
 #include <fstream>
 #include <string>
+#include <chrono>
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -256,6 +262,33 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(80, subFoo2.Data());			
 		}
 
+		TEST_METHOD(EventQueueUpdateThrows)
+		{
+			GameTime gameTime;
+			EventQueue eventQueue;
+			SubscriberFooThrow subThrow;
+			SubscriberFoo subFoo;
+			Event<Foo>::Subscribe(subThrow);
+			Event<Foo>::Subscribe(subFoo);
+
+			eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(10)), gameTime, 0ms);
+			Assert::ExpectException<std::runtime_error>([&eventQueue, &gameTime] { eventQueue.Update(gameTime); });
+			Assert::AreEqual(1_z, subThrow.NotifyCount());
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			// the events the failed Update took off the queue are gone, not delivered again
+			subThrow.SetThrows(false);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(1_z, subThrow.NotifyCount());
+
+			eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(20)), gameTime, 0ms);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(2_z, subThrow.NotifyCount());
+			Assert::AreEqual(20, subFoo.Data());
+
+			Event<Foo>::UnsubscribeAll();
+		}
+
 		TEST_METHOD(PendingUnsubscribe)
 		{
 			GameTime gameTime;
@@ -437,6 +470,109 @@ namespace UnitTestLibraryDesktop
 			Event<Foo>::UnsubscribeAll();
 		}
 
+		TEST_METHOD(SubscriberSnapshot)
+		{
+			Foo foo(30);
+			Event<Foo> event(foo);
+			SubscriberFoo subFoo1, subFoo2;
+
+			// changes take effect on the next delivery, and the last one made to a subscriber wins
+			Event<Foo>::Subscribe(subFoo1);
+			Event<Foo>::Unsubscribe(subFoo1);
+			Event<Foo>::Subscribe(subFoo2);
+			Event<Foo>::Unsubscribe(subFoo2);
+			Event<Foo>::Subscribe(subFoo2);
+			event.Deliver();
+			Assert::AreEqual(0, subFoo1.Data());
+			Assert::AreEqual(30, subFoo2.Data());
+
+			// subscribing twice still notifies once, even though the subscriber unsubscribes itself on the way
+			GameTime gameTime;
+			EventQueue eventQueue;
+			SubscriberFooEnque subFoo3(&eventQueue, &gameTime);
+			Event<Foo>::Subscribe(subFoo3);
+			Event<Foo>::Subscribe(subFoo3);
+			event.Deliver();
+			Assert::AreEqual(30, subFoo3.Data());
+			Assert::AreEqual(1_z, eventQueue.Size());
+			eventQueue.Clear();
+
+			// unsubscribing a subscriber that was never subscribed does nothing
+			SubscriberFoo subFoo4(4);
+			Event<Foo>::Unsubscribe(subFoo4);
+			subFoo2.SetData(0);
+			event.Deliver();
+			Assert::AreEqual(30, subFoo2.Data());
+			Assert::AreEqual(4, subFoo4.Data());
+
+			// subscribers coming and going on other threads never hold up, or tear, a delivery
+			SubscriberFoo subFoos[4];
+			Vector<thread*> threads;
+			for (size_t i = 0; i < 4; ++i)
+			{
+				threads.PushBack(new thread([&subFoos, i]
+				{
+					for (size_t repeat = 0; repeat < 100; ++repeat)
+					{
+						Event<Foo>::Subscribe(subFoos[i]);
+						Event<Foo>::Unsubscribe(subFoos[i]);
+					}
+					Event<Foo>::Subscribe(subFoos[i]);
+				}));
+			}
+			for (size_t repeat = 0; repeat < 100; ++repeat)
+			{
+				event.Deliver();
+			}
+			for (thread* t : threads)
+			{
+				t->join();
+				delete t;
+			}
+
+			Event<Foo> lastEvent(Foo(40));
+			lastEvent.Deliver();
+			for (SubscriberFoo& subFoo : subFoos)
+			{
+				Assert::AreEqual(40, subFoo.Data());
+			}
+			Assert::AreEqual(40, subFoo2.Data());
+
+			Event<Foo>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(UnsubscribeWaitsForDelivery)
+		{
+			SubscriberFoo subFoo;
+			Event<Foo>::Subscribe(subFoo);
+
+			// subscribers destroyed as soon as Unsubscribe returns are never notified by a delivery still running on another thread
+			atomic<bool> isDone{ false };
+			thread deliverer([&isDone]
+			{
+				Event<Foo> event(Foo(50));
+				while (!isDone)
+				{
+					event.Deliver();
+				}
+			});
+
+			for (size_t repeat = 0; repeat < 1000; ++repeat)
+			{
+				SubscriberFoo* subscriber = new SubscriberFoo();
+				Event<Foo>::Subscribe(*subscriber);
+				this_thread::yield();
+				Event<Foo>::Unsubscribe(*subscriber);
+				delete subscriber;
+			}
+
+			isDone = true;
+			deliverer.join();
+			Assert::AreEqual(50, subFoo.Data());
+
+			Event<Foo>::UnsubscribeAll();
+		}
+
 		TEST_METHOD(AsyncEnqueueUpdate)
 		{
 			EventQueue eventQueue;
@@ -492,6 +628,216 @@ namespace UnitTestLibraryDesktop
 			Event<Foo>::UnsubscribeAll();
 		}
 
+		TEST_METHOD(JobSystemDelivery)
+		{
+			JobSystem jobSystem(3);
+			EventQueue eventQueue;
+			eventQueue.SetJobSystem(&jobSystem);
+			Assert::IsTrue(&jobSystem == eventQueue.GetJobSystem());
+
+			GameTime gameTime;
+
+			SubscriberFoo subFoos[100];
+			SubscriberFooUnsubSelf unsubFoos[100];
+			for (int i = 0; i < 100; ++i)
+			{
+				subFoos[i].SetData(i);
+				Event<Foo>::Subscribe(subFoos[i]);
+				unsubFoos[i].SetData(i);
+				Event<Foo>::Subscribe(unsubFoos[i]);
+			}
+
+			// Deliver fans the subscribers out over the job system
+			Foo foo(2019);
+			Event<Foo> fooEvent(foo);
+			fooEvent.Deliver(&jobSystem);
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(2019, subFoos[i].Data());
+				Assert::AreEqual(2019, unsubFoos[i].Data());
+			}
+
+			// Update delivers every expired event as a job, and each of those delivers its subscribers as jobs of its own
+			for (int i = 0; i < 10; ++i)
+			{
+				eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(2020)), gameTime, 0ms);
+			}
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 500ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(2020, subFoos[i].Data());
+				Assert::AreEqual(2019, unsubFoos[i].Data());
+			}
+
+			eventQueue.Send(std::make_shared<Event<Foo>>(Foo(2021)));
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(2021, subFoos[i].Data());
+			}
+
+			Event<Foo>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(BatchedDelivery)
+		{
+			GameTime gameTime;
+			EventQueue eventQueue;
+			SubscriberFooBatch batchSubscriber;
+			SubscriberFoo subFoo;
+			Event<Foo>::Subscribe(batchSubscriber);
+			Event<Foo>::Subscribe(subFoo);
+			Event<Bar>::Subscribe(batchSubscriber);
+
+			// types interleaved in the queue, each type's events still arrive in expiry order
+			for (int i = 0; i < 5; ++i)
+			{
+				eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(i)), gameTime, MilliSeconds(i));
+				eventQueue.Enqueue(std::make_shared<Event<Bar>>(Bar(10 + i)), gameTime, MilliSeconds(i));
+			}
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 500ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			// one call per type instead of one per event
+			Assert::AreEqual(2_z, batchSubscriber.BatchCount());
+			Assert::AreEqual(5_z, batchSubscriber.FooValues().Size());
+			Assert::AreEqual(5_z, batchSubscriber.BarValues().Size());
+			for (int i = 0; i < 5; ++i)
+			{
+				Assert::AreEqual(i, batchSubscriber.FooValues()[i]);
+				Assert::AreEqual(10 + i, batchSubscriber.BarValues()[i]);
+			}
+
+			// subscribers that only implement Notify still get every event, the last one last
+			Assert::AreEqual(4, subFoo.Data());
+
+			JobSystem jobSystem(3);
+			eventQueue.SetJobSystem(&jobSystem);
+			for (int i = 0; i < 100; ++i)
+			{
+				eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(100 + i)), gameTime, MilliSeconds(i));
+			}
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 500ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			Assert::AreEqual(3_z, batchSubscriber.BatchCount());
+			Assert::AreEqual(105_z, batchSubscriber.FooValues().Size());
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(100 + i, batchSubscriber.FooValues()[5 + i]);
+			}
+			Assert::AreEqual(199, subFoo.Data());
+
+			Event<Foo>::UnsubscribeAll();
+			Event<Bar>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(ConcurrentEnqueue)
+		{
+			const size_t producerCount = 8;
+			const size_t eventsPerProducer = 1000;
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			SubscriberFoo subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			// producers never wait on each other or on Update, which keeps draining and delivering meanwhile
+			atomic<size_t> finished{ 0 };
+			Vector<thread*> producers;
+			for (size_t i = 0; i < producerCount; ++i)
+			{
+				producers.PushBack(new thread([&eventQueue, &gameTime, &finished, i, eventsPerProducer]
+				{
+					for (size_t j = 0; j < eventsPerProducer; ++j)
+					{
+						eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(static_cast<int>(i))), gameTime, 0ms);
+					}
+					++finished;
+				}));
+			}
+
+			while (finished < producerCount)
+			{
+				eventQueue.Update(gameTime);
+			}
+
+			for (thread* producer : producers)
+			{
+				producer->join();
+				delete producer;
+			}
+
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+			Assert::AreEqual(0_z, eventQueue.Size());
+
+			// events still on the intake list when the queue goes away are released with it
+			{
+				EventQueue discarded;
+				discarded.Enqueue(std::make_shared<Event<Foo>>(Foo(1)), gameTime);
+				Assert::AreEqual(1_z, discarded.Size());
+			}
+
+			eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(1)), gameTime);
+			eventQueue.Clear();
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			Event<Foo>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(DelayedEventBenchmark)
+		{
+			const int count = 100000;
+			const int frames = 1000;
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			SubscriberFoo subscriber;
+			Event<Foo>::Subscribe(subscriber);
+
+			// delays scrambled over [1ms, 100s]
+			for (int i = 0; i < count; ++i)
+			{
+				eventQueue.Enqueue(std::make_shared<Event<Foo>>(Foo(i)), gameTime, MilliSeconds((i * 7919) % count + 1));
+			}
+
+			// nothing is due yet: Update only looks at the top of the heap
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(static_cast<size_t>(count), eventQueue.Size());
+
+			auto start = std::chrono::high_resolution_clock::now();
+			for (int frame = 0; frame < frames; ++frame)
+			{
+				eventQueue.Update(gameTime);
+			}
+			const auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+			Assert::AreEqual(static_cast<size_t>(count), eventQueue.Size());
+
+			// 100ms a frame, about a hundred events come due each frame
+			const auto baseTime = gameTime.CurrentTime();
+			start = std::chrono::high_resolution_clock::now();
+			for (int frame = 1; frame <= frames; ++frame)
+			{
+				gameTime.SetCurrentTime(baseTime + MilliSeconds(frame * count / frames));
+				eventQueue.Update(gameTime);
+			}
+			const auto firingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			Logger::WriteMessage(("EventQueue idle Update, 100k waiting:   " + std::to_string(idleTime / frames) + "us per frame\n").c_str());
+			Logger::WriteMessage(("EventQueue firing Update, 100k waiting: " + std::to_string(firingTime / frames) + "us per frame\n").c_str());
+
+			Event<Foo>::UnsubscribeAll();
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -4,6 +4,7 @@
 #include <fstream>
 #include "Foo.h"
 #include "DerivedFoo.h"
+#include "ThrowingFoo.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -97,6 +98,45 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual("DerivedFoo"s, derivedFooFactory.ClassName());
 		}
 
+		TEST_METHOD(Recycle)
+		{
+			{
+				FooFactory fooFactory;
+				RTTI* product = Factory<RTTI>::Create("Foo"s);
+				product->As<Foo>()->SetData(10);
+
+				Factory<RTTI>::Recycle(product);
+				Assert::AreEqual(size_t(1), fooFactory.PoolSize());
+
+				RTTI* recycled = Factory<RTTI>::Create("Foo"s);
+				Assert::IsTrue(recycled == product);
+				Assert::AreEqual(0, recycled->As<Foo>()->Data());
+				Assert::AreEqual(size_t(0), fooFactory.PoolSize());
+
+				// pooled products are deleted with their factory
+				Factory<RTTI>::Recycle(recycled);
+			}
+
+			// without a factory there is no pool, the product is deleted
+			Factory<RTTI>::Recycle(new Foo(10));
+		}
+
+		TEST_METHOD(RecycleFailedReset)
+		{
+			ThrowingFooFactory throwingFooFactory;
+			RTTI* product = Factory<RTTI>::Create("ThrowingFoo"s);
+
+			// a product that cannot be constructed again is freed, not pooled, and recycling it does not throw
+			ThrowingFoo::Throws = true;
+			Factory<RTTI>::Recycle(product);
+			ThrowingFoo::Throws = false;
+			Assert::AreEqual(size_t(0), throwingFooFactory.PoolSize());
+
+			product = Factory<RTTI>::Create("ThrowingFoo"s);
+			Factory<RTTI>::Recycle(product);
+			Assert::AreEqual(size_t(1), throwingFooFactory.PoolSize());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -0,0 +1,305 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "FlatHashmap.h"
+#include "Foo.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std;
+using namespace std::string_literals;
+
+namespace Library
+{
+	template<>
+	struct DefaultHash<Foo>
+	{
+		inline std::size_t operator()(const Foo& key) const
+		{
+			return key.Data();
+		}
+	};
+}
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<Library::Foo>(const Library::Foo& t)
+	{
+		RETURN_WIDE_STRING(t.Data());
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FlatHashmapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+#pragma region Iterator Tests
+
+		TEST_METHOD(PreIncrement)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			{
+				auto itEmpty = FlatHashmap<TKey, TData>::Iterator();
+				Assert::ExpectException<std::runtime_error>([&itEmpty] { ++itEmpty; });
+			}
+
+			FlatHashmap<TKey, TData> list;
+			Assert::AreEqual(0_z, list.Size());
+			Assert::AreEqual(32_z, list.BucketSize());
+
+			{
+				auto it = list.begin();
+				Assert::ExpectException<std::runtime_error>([&it] { ++it; });
+			}
+
+			list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			list.Insert(std::pair<TKey, TData>(Foo(13), 31));
+			list.Insert(std::pair<TKey, TData>(Foo(14), 41));
+
+			auto it = list.begin();
+			Assert::AreEqual(Foo(12), (*it).first);
+			Assert::AreEqual(21, (*it).second);
+
+			auto preInc = ++it;
+			Assert::AreEqual(Foo(13), (*it).first);
+			Assert::AreEqual(Foo(13), (*preInc).first);
+
+			++it;
+			Assert::AreEqual(Foo(14), it->first);
+			Assert::AreEqual(41, it->second);
+
+			++it;
+			Assert::IsTrue(it == list.end());
+			Assert::ExpectException<std::runtime_error>([&it] { *it; });
+			Assert::ExpectException<std::runtime_error>([&it] { ++it; });
+		}
+
+		TEST_METHOD(PostIncrementConst)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			FlatHashmap<TKey, TData> list;
+			list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			list.Insert(std::pair<TKey, TData>(Foo(13), 31));
+
+			const FlatHashmap<TKey, TData>& constList = list;
+			auto it = constList.begin();
+			auto postInc = it++;
+			Assert::AreEqual(Foo(12), (*postInc).first);
+			Assert::AreEqual(Foo(13), (*it).first);
+
+			it++;
+			Assert::IsTrue(it == constList.cend());
+			Assert::ExpectException<std::runtime_error>([&it] { *it; });
+
+			FlatHashmap<TKey, TData>::ConstIterator converted(list.begin());
+			Assert::IsTrue(converted == constList.cbegin());
+		}
+
+#pragma endregion Iterator Tests
+
+#pragma region FlatHashmap Tests
+
+		TEST_METHOD(Constructor)
+		{
+			FlatHashmap<int, int> list;
+			Assert::AreEqual(0_z, list.Size());
+			Assert::AreEqual(32_z, list.BucketSize());
+			Assert::IsTrue(list.begin() == list.end());
+
+			// slot count rounds up to a power of two
+			FlatHashmap<int, int> sized(79);
+			Assert::AreEqual(128_z, sized.BucketSize());
+
+			FlatHashmap<std::string, int> initList{ { "a", 1 }, { "b", 2 }, { "c", 3 } };
+			Assert::AreEqual(3_z, initList.Size());
+			Assert::AreEqual(2, initList.At("b"));
+		}
+
+		TEST_METHOD(DeepCopy)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			FlatHashmap<TKey, TData> list;
+			list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			list.Insert(std::pair<TKey, TData>(Foo(44), 41));
+
+			FlatHashmap<TKey, TData> copy(list);
+			Assert::AreEqual(list.Size(), copy.Size());
+			Assert::AreEqual(21, copy.At(Foo(12)));
+			Assert::AreNotSame(list.At(Foo(12)), copy.At(Foo(12)));
+
+			copy[Foo(12)] = 100;
+			Assert::AreEqual(21, list.At(Foo(12)));
+
+			FlatHashmap<TKey, TData> assigned;
+			assigned.Insert(std::pair<TKey, TData>(Foo(1), 1));
+			assigned = list;
+			Assert::AreEqual(2_z, assigned.Size());
+			Assert::IsFalse(assigned.ContainsKey(Foo(1)));
+
+			FlatHashmap<TKey, TData> moved(std::move(copy));
+			Assert::AreEqual(2_z, moved.Size());
+			Assert::AreEqual(100, moved.At(Foo(12)));
+
+			assigned = std::move(moved);
+			Assert::AreEqual(100, assigned.At(Foo(12)));
+		}
+
+		TEST_METHOD(Insert)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			FlatHashmap<TKey, TData> list;
+			auto [it, isInserted] = list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			Assert::IsTrue(isInserted);
+			Assert::AreEqual(Foo(12), it->first);
+
+			// same home slot, different key
+			auto [it2, isInserted2] = list.Insert(std::pair<TKey, TData>(Foo(44), 41));
+			Assert::IsTrue(isInserted2);
+			Assert::AreEqual(Foo(44), it2->first);
+
+			auto [it3, isInserted3] = list.Insert(std::pair<TKey, TData>(Foo(12), 99));
+			Assert::IsFalse(isInserted3);
+			Assert::AreEqual(21, it3->second);
+			Assert::AreEqual(2_z, list.Size());
+		}
+
+		TEST_METHOD(Growth)
+		{
+			FlatHashmap<std::string, int> list(8);
+			Assert::AreEqual(8_z, list.BucketSize());
+
+			int* first = &list["0"];
+			for (int i = 1; i < 1000; ++i)
+			{
+				list[std::to_string(i)] = i;
+			}
+
+			Assert::AreEqual(1000_z, list.Size());
+			Assert::IsTrue(list.BucketSize() >= 1000_z);
+
+			// entries are pooled, growth only rebuilds the probe table
+			Assert::IsTrue(first == &list["0"]);
+
+			for (int i = 1; i < 1000; ++i)
+			{
+				Assert::AreEqual(i, list.At(std::to_string(i)));
+			}
+
+			size_t count = 0;
+			for (auto it = list.begin(); it != list.end(); ++it)
+			{
+				++count;
+			}
+			Assert::AreEqual(1000_z, count);
+		}
+
+		TEST_METHOD(BracketIndexAndAt)
+		{
+			FlatHashmap<std::string, int> list;
+			list["one"] = 1;
+			Assert::AreEqual(1, list["one"]);
+			Assert::AreEqual(1_z, list.Size());
+
+			Assert::AreEqual(1, list.At("one"));
+			Assert::ExpectException<std::runtime_error>([&list] { list.At("two"); });
+
+			const FlatHashmap<std::string, int>& constList = list;
+			Assert::AreEqual(1, constList["one"]);
+			Assert::ExpectException<std::runtime_error>([&constList] { constList["two"]; });
+		}
+
+		TEST_METHOD(Find)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			FlatHashmap<TKey, TData> list;
+			Assert::IsTrue(list.Find(Foo(12)) == list.end());
+
+			list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			list.Insert(std::pair<TKey, TData>(Foo(44), 41));
+
+			Assert::AreEqual(41, list.Find(Foo(44))->second);
+			Assert::IsTrue(list.Find(Foo(76)) == list.end());
+
+			const FlatHashmap<TKey, TData>& constList = list;
+			Assert::AreEqual(21, constList.Find(Foo(12))->second);
+			Assert::IsTrue(constList.ContainsKey(Foo(44)));
+			Assert::IsFalse(constList.ContainsKey(Foo(13)));
+		}
+
+		TEST_METHOD(Remove)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			FlatHashmap<TKey, TData> list;
+			list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			list.Insert(std::pair<TKey, TData>(Foo(44), 41));
+			list.Insert(std::pair<TKey, TData>(Foo(13), 31));
+
+			// removing the head of a probe run must keep the rest reachable
+			list.Remove(Foo(12));
+			Assert::AreEqual(2_z, list.Size());
+			Assert::IsFalse(list.ContainsKey(Foo(12)));
+			Assert::AreEqual(41, list.At(Foo(44)));
+			Assert::AreEqual(31, list.At(Foo(13)));
+
+			list.Remove(Foo(99));
+			Assert::AreEqual(2_z, list.Size());
+
+			list.Remove(list.Find(Foo(44)));
+			Assert::AreEqual(1_z, list.Size());
+
+			{
+				FlatHashmap<TKey, TData> list2;
+				list2.Insert(std::pair<TKey, TData>(Foo(12), 14));
+				auto it2 = list2.begin();
+				Assert::ExpectException<std::runtime_error>([&list, &it2] { list.Remove(it2); });
+			}
+
+			list.Clear();
+			Assert::AreEqual(0_z, list.Size());
+			Assert::IsTrue(list.begin() == list.end());
+			list.Insert(std::pair<TKey, TData>(Foo(12), 21));
+			Assert::AreEqual(21, list.At(Foo(12)));
+		}
+
+#pragma endregion FlatHashmap Tests
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState FlatHashmapTests::sStartMemState;
+}
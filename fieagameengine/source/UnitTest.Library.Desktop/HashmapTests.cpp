@@ -2,6 +2,7 @@
 #include "CppUnitTest.h"
 #include "hashmap.h"
 #include "Foo.h"
+#include <chrono>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -440,7 +441,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(0_z, otherList.Size());
 			Assert::AreEqual(31_z, otherList.BucketSize());
 
-			Hashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
+			RuntimeHashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
 			Assert::AreEqual(0_z, initList.Size());
 			Assert::AreEqual(79_z, initList.BucketSize());
 		}
@@ -458,7 +459,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(0_z, otherList.Size());
 			Assert::AreEqual(31_z, otherList.BucketSize());
 
-			Hashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
+			RuntimeHashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
 			Assert::AreEqual(0_z, initList.Size());
 			Assert::AreEqual(79_z, initList.BucketSize());
 		}
@@ -597,7 +598,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(0_z, otherList.Size());
 			Assert::AreEqual(31_z, otherList.BucketSize());
 
-			Hashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
+			RuntimeHashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
 			Assert::AreEqual(0_z, initList.Size());
 			Assert::AreEqual(79_z, initList.BucketSize());
 		}
@@ -1038,7 +1039,7 @@ namespace UnitTestLibraryDesktop
 				Assert::AreEqual(14, (*it).second);
 			}
 
-			Hashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
+			RuntimeHashmap<TKey, TData> initList(79, [](const TKey&) { return 10; });
 			Assert::AreEqual(0_z, initList.Size());
 			Assert::AreEqual(79_z, initList.BucketSize());
 
@@ -1207,6 +1208,118 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(AutomaticRehash)
+		{
+			using TKey = std::string;
+			using TData = int;
+
+			Hashmap<TKey, TData> list;
+			Assert::AreEqual(31_z, list.BucketSize());
+			Assert::AreEqual(Hashmap<TKey, TData>::DefaultMaxLoadFactor, list.MaxLoadFactor());
+
+			int* first = &list["0"];
+			for (int i = 1; i < 1000; ++i)
+			{
+				list.Insert(std::pair<TKey, TData>(std::to_string(i), i));
+			}
+
+			Assert::AreEqual(1000_z, list.Size());
+			Assert::IsTrue(list.BucketSize() >= 1000_z);
+			Assert::IsTrue(list.LoadFactor() <= list.MaxLoadFactor());
+
+			// nodes are relinked, not copied, so references survive a rehash
+			Assert::IsTrue(first == &list["0"]);
+			for (int i = 1; i < 1000; ++i)
+			{
+				Assert::AreEqual(i, list.At(std::to_string(i)));
+			}
+
+			size_t count = 0;
+			for (auto it = list.begin(); it != list.end(); ++it)
+			{
+				++count;
+			}
+			Assert::AreEqual(1000_z, count);
+		}
+
+		TEST_METHOD(RehashAndReserve)
+		{
+			using TKey = Foo;
+			using TData = int;
+
+			Hashmap<TKey, TData> list;
+			list.Reserve(100);
+			Assert::AreEqual(100_z, list.BucketSize());
+
+			// never shrinks
+			list.Reserve(10);
+			Assert::AreEqual(100_z, list.BucketSize());
+
+			for (int i = 0; i < 50; ++i)
+			{
+				list.Insert(std::pair<TKey, TData>(Foo(i), i));
+			}
+			Assert::AreEqual(100_z, list.BucketSize());
+			Assert::AreEqual(0.5f, list.LoadFactor());
+			Assert::AreEqual(1_z, list.LongestChain());
+
+			// cannot go below what the max load factor allows
+			list.Rehash(7);
+			Assert::AreEqual(50_z, list.BucketSize());
+
+			list.Rehash(10);
+			list.SetMaxLoadFactor(5.0f);
+			list.Rehash(10);
+			Assert::AreEqual(10_z, list.BucketSize());
+			Assert::AreEqual(5_z, list.LongestChain());
+
+			for (int i = 0; i < 50; ++i)
+			{
+				Assert::AreEqual(i, list.At(Foo(i)));
+			}
+
+			list.SetMaxLoadFactor(1.0f);
+			Assert::IsTrue(list.LoadFactor() <= 1.0f);
+			Assert::ExpectException<std::runtime_error>([&list] { list.SetMaxLoadFactor(0.0f); });
+		}
+
+		TEST_METHOD(FunctorPolicyBenchmark)
+		{
+			const int count = 10000;
+			Hashmap<int, int> inlined(1031);
+			RuntimeHashmap<int, int> erased(1031);
+			for (int i = 0; i < count; ++i)
+			{
+				inlined.Insert(std::pair<int, int>(i, i));
+				erased.Insert(std::pair<int, int>(i, i));
+			}
+
+			// same policies, so same layout, the only difference is how the hash and equality get called
+			const auto measure = [count](const auto& map)
+			{
+				long long sum = 0;
+				const auto start = std::chrono::high_resolution_clock::now();
+				for (int pass = 0; pass < 100; ++pass)
+				{
+					for (int i = 0; i < count; ++i)
+					{
+						sum += map.Find(i)->second;
+					}
+				}
+				const auto end = std::chrono::high_resolution_clock::now();
+				return std::pair<long long, long long>(sum, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+			};
+
+			const auto [inlinedSum, inlinedTime] = measure(inlined);
+			const auto [erasedSum, erasedTime] = measure(erased);
+
+			Logger::WriteMessage(("Hashmap Find:        " + std::to_string(inlinedTime) + "us\n").c_str());
+			Logger::WriteMessage(("RuntimeHashmap Find: " + std::to_string(erasedTime) + "us\n").c_str());
+
+			Assert::AreEqual(inlinedSum, erasedSum);
+			Assert::AreEqual(inlined.LongestChain(), erased.LongestChain());
+		}
+
 #pragma endregion Hashmap Tests
 
 
@@ -0,0 +1,190 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "JobSystem.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(JobSystemTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			{
+				JobSystem jobSystem(3);
+				Assert::AreEqual(3_z, jobSystem.WorkerCount());
+				Assert::AreEqual(4_z, jobSystem.SlotCount());
+			}
+			{
+				// no workers, everything runs on the calling thread
+				JobSystem jobSystem(0);
+				Assert::AreEqual(0_z, jobSystem.WorkerCount());
+				Assert::AreEqual(1_z, jobSystem.SlotCount());
+
+				size_t sum = 0;
+				jobSystem.ParallelFor(10, [&sum](size_t index, size_t slot)
+				{
+					Assert::AreEqual(0_z, slot);
+					sum += index;
+				});
+				Assert::AreEqual(45_z, sum);
+			}
+		}
+
+		TEST_METHOD(ParallelFor)
+		{
+			const size_t count = 1000;
+			JobSystem jobSystem(3);
+
+			for (size_t repeat = 0; repeat < 20; ++repeat)
+			{
+				Vector<size_t> hits;
+				hits.Reserve(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					hits.PushBack(0);
+				}
+
+				// each slot is only ever used by one thread at a time, so per slot counters need no lock
+				Vector<size_t> perSlot;
+				for (size_t i = 0; i < jobSystem.SlotCount(); ++i)
+				{
+					perSlot.PushBack(0);
+				}
+
+				jobSystem.ParallelFor(count, [&hits, &perSlot](size_t index, size_t slot)
+				{
+					++hits[index];
+					++perSlot[slot];
+				});
+
+				size_t total = 0;
+				for (size_t i = 0; i < count; ++i)
+				{
+					Assert::AreEqual(1_z, hits[i]);
+				}
+				for (size_t slotCount : perSlot)
+				{
+					total += slotCount;
+				}
+				Assert::AreEqual(count, total);
+			}
+
+			size_t calls = 0;
+			jobSystem.ParallelFor(0, [&calls](size_t, size_t) { ++calls; });
+			Assert::AreEqual(0_z, calls);
+		}
+
+		TEST_METHOD(Exceptions)
+		{
+			JobSystem jobSystem(3);
+
+			atomic<size_t> calls{ 0 };
+			auto expression = [&jobSystem, &calls]
+			{
+				jobSystem.ParallelFor(100, [&calls](size_t index, size_t)
+				{
+					++calls;
+					if (index == 42)
+					{
+						throw runtime_error("Job failed.");
+					}
+				});
+			};
+			Assert::ExpectException<runtime_error>(expression);
+			Assert::IsTrue(calls > 0);
+
+			// still usable afterwards
+			atomic<size_t> sum{ 0 };
+			jobSystem.ParallelFor(10, [&sum](size_t index, size_t) { sum += index; });
+			Assert::AreEqual(45_z, sum.load());
+		}
+
+		TEST_METHOD(SubmitWait)
+		{
+			JobSystem jobSystem(3);
+			JobSystem::WaitGroup group;
+			Assert::IsTrue(group.IsDone());
+
+			atomic<size_t> sum{ 0 };
+			jobSystem.Submit(group, [&sum](size_t) { sum += 100; });
+
+			Vector<JobSystem::Job> jobs;
+			jobs.Reserve(10);
+			for (size_t i = 0; i < 10; ++i)
+			{
+				jobs.PushBack([&sum, i](size_t) { sum += i; });
+			}
+			jobSystem.Submit(group, jobs);
+			Assert::IsTrue(jobs.IsEmpty());
+
+			jobSystem.Wait(group);
+			Assert::IsTrue(group.IsDone());
+			Assert::AreEqual(145_z, sum.load());
+
+			// waiting on an empty group returns straight away
+			jobSystem.Wait(group);
+
+			jobSystem.Submit(group, [](size_t) { throw runtime_error("Job failed."); });
+			auto expression = [&jobSystem, &group] { jobSystem.Wait(group); };
+			Assert::ExpectException<runtime_error>(expression);
+			Assert::IsTrue(group.IsDone());
+		}
+
+		TEST_METHOD(Nested)
+		{
+			JobSystem jobSystem(3);
+
+			// jobs waiting on jobs of their own only help with those, so nesting cannot deadlock
+			atomic<size_t> sum{ 0 };
+			jobSystem.ParallelFor(8, [&jobSystem, &sum](size_t, size_t)
+			{
+				jobSystem.ParallelFor(100, [&sum](size_t index, size_t) { sum += index; });
+			});
+			Assert::AreEqual(8 * 4950_z, sum.load());
+
+			JobSystem::WaitGroup group;
+			for (size_t i = 0; i < 4; ++i)
+			{
+				jobSystem.Submit(group, [&jobSystem, &sum](size_t)
+				{
+					JobSystem::WaitGroup inner;
+					jobSystem.Submit(inner, [&sum](size_t) { ++sum; });
+					jobSystem.Wait(inner);
+				});
+			}
+			jobSystem.Wait(group);
+			Assert::AreEqual(8 * 4950_z + 4, sum.load());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState JobSystemTests::sStartMemState;
+}
@@ -2,12 +2,15 @@
 #include "CppUnitTest.h"
 #include "JsonParseMaster.h"
 #include "JsonTestParseHelper.h"
+#include "JsonTokenizer.h"
 #include <fstream>
+#include <sstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
 using namespace std;
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 
 namespace Microsoft::VisualStudio::CppUnitTestFramework
 {
@@ -355,6 +358,94 @@ namespace UnitTestLibraryDesktop
 		{
 		}
 
+		TEST_METHOD(Tokenizer)
+		{
+			using TokenType = JsonTokenizer::TokenType;
+			std::stringstream input(R"({
+				// comments are skipped
+				"b": [ 1, -2.5, "a\"\u00e9" ], /* like JsonCpp */
+				"a": { "t": true, "n": null }
+			})");
+
+			JsonTokenizer tokenizer(input);
+			Assert::IsTrue(TokenType::BeginObject == tokenizer.Next());
+			Assert::IsTrue(tokenizer.Value().IsObject());
+
+			// members come in document order, not sorted
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			Assert::IsTrue("b"sv == tokenizer.Key());
+			Assert::IsTrue(TokenType::BeginArray == tokenizer.Next());
+			Assert::IsTrue(TokenType::Value == tokenizer.Next());
+			Assert::AreEqual(1, tokenizer.Value().AsInt());
+			Assert::IsTrue(TokenType::Value == tokenizer.Next());
+			Assert::AreEqual(-2.5f, tokenizer.Value().AsFloat());
+			Assert::IsTrue(TokenType::Value == tokenizer.Next());
+			Assert::IsTrue("a\"\xC3\xA9"sv == tokenizer.Value().AsString());
+			Assert::IsTrue(TokenType::EndArray == tokenizer.Next());
+			Assert::AreEqual(3_z, tokenizer.Line());
+
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			Assert::IsTrue("a"sv == tokenizer.Key());
+			Assert::IsTrue(TokenType::BeginObject == tokenizer.Next());
+			tokenizer.Skip();
+			Assert::IsTrue(TokenType::EndObject == tokenizer.Next());
+			Assert::IsTrue(TokenType::End == tokenizer.Next());
+		}
+
+		TEST_METHOD(TokenizerViews)
+		{
+			using TokenType = JsonTokenizer::TokenType;
+			const std::string text = R"({ "plain": "value", "escaped\n": { "inner": 12 } })";
+			const auto isInText = [&text](std::string_view view)
+			{
+				return view.data() >= text.data() && view.data() + view.size() <= text.data() + text.size();
+			};
+
+			JsonTokenizer tokenizer(text);
+			Assert::IsTrue(TokenType::BeginObject == tokenizer.Next());
+
+			// nothing to decode, the key and value are the text itself
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			Assert::IsTrue(isInText(tokenizer.Key()));
+			Assert::IsTrue(TokenType::Value == tokenizer.Next());
+			Assert::IsTrue(JsonValue::ValueType::String == tokenizer.Value().Type());
+			Assert::IsTrue("value"sv == tokenizer.Value().AsString());
+			Assert::IsTrue(isInText(tokenizer.Value().AsString()));
+
+			// an escaped key is decoded, and stays good while its object is read
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			const std::string_view key = tokenizer.Key();
+			Assert::IsFalse(isInText(key));
+			Assert::IsTrue(TokenType::BeginObject == tokenizer.Next());
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			Assert::IsTrue(TokenType::Value == tokenizer.Next());
+			Assert::IsTrue(JsonValue::ValueType::Integer == tokenizer.Value().Type());
+			Assert::AreEqual(12.0f, tokenizer.Value().AsFloat());
+			Assert::IsTrue(TokenType::EndObject == tokenizer.Next());
+			Assert::IsTrue("escaped\n"sv == key);
+
+			Assert::IsTrue(TokenType::EndObject == tokenizer.Next());
+			Assert::IsTrue(TokenType::End == tokenizer.Next());
+		}
+
+		TEST_METHOD(MalformedInput)
+		{
+			JsonTestParseHelper testParseHelper;
+			JsonTestParseHelper::SharedData testSharedData;
+			JsonParseMaster parseMaster(testSharedData);
+			parseMaster.AddHelper(testParseHelper);
+
+			const std::string inputs[] = { ""s, "[ 1 ]"s, R"({ "a": 1 )"s, R"({ "a" 1 })"s, R"({ "a": 1, })"s, R"({ "a": tru })"s, R"({ "a": "b })"s, R"({ "a": 1 } })"s };
+			for (const std::string& input : inputs)
+			{
+				parseMaster.Initialize();
+				Assert::ExpectException<std::runtime_error>([&parseMaster, &input]
+				{
+					parseMaster.Parse(input);
+				});
+			}
+		}
+
 		TEST_METHOD(JsonParseTestHelperSharedDataRTTI)
 		{
 			JsonTestParseHelper::SharedData sharedData;
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "JsonTableParseHelper.h"
+#include "Entity.h"
+#include "TypeManager.h"
 #include <fstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -48,6 +50,8 @@ namespace UnitTestLibraryDesktop
 	public:
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
+			TypeManager::RegisterType(Entity::TypeIdClass(), Entity::Signatures());
+
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
@@ -357,6 +361,100 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(12, (*pistolScope)["Bullets"].Get<std::int32_t>());
 		}
 
+		TEST_METHOD(ParseStringOutOfOrderKeys)
+		{
+			const std::string input = R"(
+			{
+			  "Health": {
+				"value": 100,
+				"type": "integer"
+			  },
+			  "Primes": {
+				"value": [ 3, 5 ],
+				"type": "integer"
+			  },
+			  "Weapon": {
+				"value": {
+				  "Bullets": {
+					"value": 12,
+					"type": "integer"
+				  }
+				},
+				"type": "table"
+			  },
+			  "Hero": {
+				"type": "table",
+				"value": {
+				  "Name": {
+					"value": "Link",
+					"type": "string"
+				  },
+				  "Level": {
+					"type": "integer",
+					"value": 3
+				  }
+				},
+				"class": "Entity"
+			  },
+			  "Party": {
+				"value": [
+				  {
+					"value": {
+					  "Name": {
+						"type": "string",
+						"value": "Zelda"
+					  }
+					},
+					"class": "Entity",
+					"type": "table"
+				  }
+				],
+				"type": "table"
+			  }
+			}
+			)"s;
+
+			EntityFactory entityFactory;
+			JsonTableParseHelper tableParseHelper;
+			Scope scope;
+			JsonTableParseHelper::SharedData tableSharedData(scope);
+			JsonParseMaster parseMaster(tableSharedData);
+			parseMaster.AddHelper(tableParseHelper);
+
+			parseMaster.Initialize();
+			parseMaster.Parse(input);
+
+			Assert::AreEqual(100, scope["Health"].Get<std::int32_t>());
+			Assert::AreEqual(2_z, scope["Primes"].Size());
+			Assert::AreEqual(3, scope["Primes"].Get<std::int32_t>(0));
+			Assert::AreEqual(5, scope["Primes"].Get<std::int32_t>(1));
+			Assert::AreEqual(12, scope["Weapon"][0]["Bullets"].Get<std::int32_t>());
+
+			Assert::AreEqual(1_z, scope["Hero"].Size());
+			Entity* hero = scope["Hero"][0].As<Entity>();
+			Assert::IsNotNull(hero);
+			Assert::AreEqual("Link"s, hero->Name());
+			Assert::AreEqual(3, (*hero)["Level"].Get<std::int32_t>());
+			Assert::AreEqual(static_cast<Scope*>(&scope), hero->GetParent());
+
+			Assert::AreEqual(1_z, scope["Party"].Size());
+			Entity* zelda = scope["Party"][0].As<Entity>();
+			Assert::IsNotNull(zelda);
+			Assert::AreEqual("Zelda"s, zelda->Name());
+
+			parseMaster.Initialize();
+			Assert::ExpectException<std::runtime_error>([&parseMaster]
+			{
+				parseMaster.Parse(R"({ "Untyped": { "value": 1 } })"s);
+			});
+
+			parseMaster.Initialize();
+			Assert::ExpectException<std::runtime_error>([&parseMaster]
+			{
+				parseMaster.Parse(R"({ "Mistyped": { "value": { }, "type": "integer" } })"s);
+			});
+		}
+
 		TEST_METHOD(ParseFilePrimitives)
 		{
 			const std::string fileName = "tableTest.json";
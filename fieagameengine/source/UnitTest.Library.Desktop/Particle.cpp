@@ -0,0 +1,28 @@
+#include "pch.h"
+#include "Particle.h"
+
+namespace Library
+{
+	RTTI_DEFINITIONS(Particle)
+
+	Particle::Particle() :
+		Entity(TypeIdClass())
+	{
+	}
+
+	Vector<Signature> Particle::Signatures()
+	{
+		Vector<Signature> signatures = Entity::Signatures();
+
+		signatures.PushBack({ "Position", Datum::DatumTypes::Vector, 1, Signature::Pooled });
+		signatures.PushBack({ "Velocity", Datum::DatumTypes::Vector, 1, Signature::Pooled });
+		signatures.PushBack({ "Tag", Datum::DatumTypes::String, 1, Signature::Pooled });
+
+		return signatures;
+	}
+
+	gsl::owner<Scope*> Particle::Clone() const
+	{
+		return new Particle(*this);
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Entity.h"
+#include "Factory.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Entity whose Position, Velocity and Tag have no members, they live in the type's AttributePool
+	/// </summary>
+	class Particle final : public Entity
+	{
+		RTTI_DECLARATIONS(Particle, Entity)
+	public:
+		Particle();
+		Particle(const Particle& rhs) = default;
+		Particle(Particle&& rhs) noexcept = default;
+		Particle& operator=(const Particle& rhs) = default;
+		Particle& operator=(Particle&& rhs) noexcept = default;
+		virtual ~Particle() = default;
+
+		static Vector<Signature> Signatures();
+
+		virtual gsl::owner<Scope*> Clone() const override;
+	};
+
+	ConcreteFactory(Particle, Scope)
+}
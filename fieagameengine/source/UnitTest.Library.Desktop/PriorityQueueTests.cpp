@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "PriorityQueue.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(PriorityQueueTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			PriorityQueue<int> queue;
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(0_z, queue.Size());
+
+			auto top = [&queue] { queue.Top(); };
+			Assert::ExpectException<runtime_error>(top);
+			auto pop = [&queue] { queue.Pop(); };
+			Assert::ExpectException<runtime_error>(pop);
+			auto popTop = [&queue] { queue.PopTop(); };
+			Assert::ExpectException<runtime_error>(popTop);
+		}
+
+		TEST_METHOD(PushPop)
+		{
+			const int count = 1000;
+			PriorityQueue<int> queue(count);
+
+			// a scrambled permutation of [0, count)
+			for (int i = 0; i < count; ++i)
+			{
+				queue.Push((i * 7919) % count);
+			}
+			Assert::AreEqual(static_cast<size_t>(count), queue.Size());
+
+			for (int i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(i, queue.Top());
+				Assert::AreEqual(i, queue.PopTop());
+			}
+			Assert::IsTrue(queue.IsEmpty());
+
+			// duplicates all come out
+			queue.Push(5);
+			queue.Push(5);
+			queue.Push(1);
+			queue.Pop();
+			Assert::AreEqual(5, queue.PopTop());
+			Assert::AreEqual(5, queue.PopTop());
+			Assert::IsTrue(queue.IsEmpty());
+		}
+
+		TEST_METHOD(Ordering)
+		{
+			// greater makes it a max-heap
+			PriorityQueue<int, std::greater<int>> queue;
+			const int a = 10;
+			queue.Push(a);
+			queue.Push(30);
+			queue.Push(20);
+
+			Assert::AreEqual(30, queue.PopTop());
+			Assert::AreEqual(20, queue.PopTop());
+			Assert::AreEqual(10, queue.Top());
+		}
+
+		TEST_METHOD(Clear)
+		{
+			PriorityQueue<int> queue;
+			queue.Reserve(10);
+			for (int i = 0; i < 10; ++i)
+			{
+				queue.Push(i);
+			}
+
+			PriorityQueue<int> copy(queue);
+			queue.Clear();
+			Assert::IsTrue(queue.IsEmpty());
+			queue.ShrinkToFit();
+
+			Assert::AreEqual(10_z, copy.Size());
+			Assert::AreEqual(0, copy.Top());
+
+			queue = std::move(copy);
+			Assert::AreEqual(10_z, queue.Size());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState PriorityQueueTests::sStartMemState;
+}
@@ -11,10 +11,13 @@
 #include "GameTime.h"
 #include "Reaction.h"
 #include "ReactionAttributed.h"
+#include "ReactionDispatcher.h"
 #include "EventMessageAttributed.h"
 #include "JsonTableParseHelper.h"
 #include "ActionEvent.h"
 #include "ActionIncrement.h"
+#include "ActionDelete.h"
+#include "CallFrame.h"
 #include "Foo.h"
 #include "Bar.h"
 #include <fstream>
@@ -67,6 +70,7 @@ namespace UnitTestLibraryDesktop
 			TypeManager::RegisterType(Action::TypeIdClass(), Action::Signatures());
 			TypeManager::RegisterType(ActionList::TypeIdClass(), ActionList::Signatures());
 			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures());
+			TypeManager::RegisterType(ActionDelete::TypeIdClass(), ActionDelete::Signatures());
 			TypeManager::RegisterType(Reaction::TypeIdClass(), Reaction::Signatures());
 			TypeManager::RegisterType(EventMessageAttributed::TypeIdClass(), EventMessageAttributed::Signatures());
 			TypeManager::RegisterType(ReactionAttributed::TypeIdClass(), ReactionAttributed::Signatures());
@@ -105,6 +109,18 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(rtti->Is("Attributed"s));
 			Assert::IsTrue(rtti->Is("Scope"s));
 			Assert::IsTrue(rtti->Is(ReactionAttributed::TypeIdClass()));
+
+			Assert::IsTrue(rtti->Is<ReactionAttributed>());
+			Assert::IsTrue(rtti->Is<Reaction>());
+			Assert::IsTrue(rtti->Is<Action>());
+			Assert::IsTrue(rtti->Is<Scope>());
+			Assert::IsFalse(rtti->Is<ActionEvent>());
+			Assert::IsFalse(rtti->Is<Bar>());
+			Assert::IsFalse(rtti->Is<RTTI>());
+			Assert::AreEqual(ReactionAttributed::TypeDepth(), rtti->AncestryInstance().Depth);
+			Assert::AreEqual(Scope::TypeIdClass(), rtti->AncestryInstance().Ids[0]);
+			static_assert(ReactionAttributed::TypeNameHash() == RTTI::HashName("ReactionAttributed"));
+			Assert::AreEqual(ReactionAttributed::TypeNameHash(), RTTI::HashName(ReactionAttributed::TypeName().c_str()));
 			
 			Assert::IsTrue(rtti->Is(rtti->TypeIdInstance()));
 			Assert::AreEqual(ReactionAttributed::TypeIdClass(), rtti->TypeIdInstance());
@@ -333,6 +349,259 @@ namespace UnitTestLibraryDesktop
 			Event<EventMessageAttributed>::UnsubscribeAll();
 		}
 
+		TEST_METHOD(SubtypeDispatchTest)
+		{
+			ReactionAttributedFactory reactionsAttributedFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::steady_clock::now());
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+			EventQueue eventQueue;
+
+			World world("TestWorld", eventQueue);
+			Entity* entity = world.CreateSector("TestSector"s)->CreateEntity("Entity"s, "TestEntity"s);
+
+			ReactionAttributed* reactions[3];
+			ActionIncrement* increments[3];
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				reactions[i] = entity->CreateAction("ReactionAttributed", "TestReaction"s + std::to_string(i))->As<ReactionAttributed>();
+				increments[i] = reactions[i]->CreateAction("ActionIncrement", "actionIncrement")->As<ActionIncrement>();
+				(*increments[i])["Target"] = "Number";
+				(*increments[i])["Number"] = 0;
+			}
+			reactions[0]->SetSubtype("Hit"s);
+			reactions[1]->SetSubtype("Hit"s);
+			reactions[2]->SetSubtype("Miss"s);
+			Assert::AreEqual(2_z, ReactionDispatcher::ReactionCount("Hit"s));
+			Assert::AreEqual(1_z, ReactionDispatcher::ReactionCount("Miss"s));
+			Assert::AreEqual(0_z, ReactionDispatcher::ReactionCount("NeverUsedSubtype"s));
+
+			// reactions run on the world state of the world's last update
+			world.Update(worldState);
+
+			auto send = [&eventQueue, &world](const std::string& subtype)
+			{
+				EventMessageAttributed message;
+				message.SetWorld(world);
+				message.SetSubType(subtype);
+				eventQueue.Send(std::make_shared<Event<EventMessageAttributed>>(std::move(message)));
+			};
+
+			// only the reactions of the event's subtype react
+			send("Hit"s);
+			Assert::AreEqual(1, (*increments[0])["Number"].Get<std::int32_t>());
+			Assert::AreEqual(1, (*increments[1])["Number"].Get<std::int32_t>());
+			Assert::AreEqual(0, (*increments[2])["Number"].Get<std::int32_t>());
+
+			send("NeverUsedSubtype"s);
+			Assert::AreEqual(1, (*increments[0])["Number"].Get<std::int32_t>());
+			Assert::AreEqual(0, (*increments[2])["Number"].Get<std::int32_t>());
+
+			// a subtype written through the datum is picked up on the reaction's next update
+			(*reactions[2])["SubType"] = "Hit"s;
+			world.Update(worldState);
+			Assert::AreEqual(3_z, ReactionDispatcher::ReactionCount("Hit"s));
+			Assert::AreEqual(0_z, ReactionDispatcher::ReactionCount("Miss"s));
+
+			send("Hit"s);
+			Assert::AreEqual(2, (*increments[0])["Number"].Get<std::int32_t>());
+			Assert::AreEqual(2, (*increments[1])["Number"].Get<std::int32_t>());
+			Assert::AreEqual(1, (*increments[2])["Number"].Get<std::int32_t>());
+
+			// clones are registered for their subtype as well
+			Scope* clone = reactions[0]->Clone();
+			Assert::AreEqual(4_z, ReactionDispatcher::ReactionCount("Hit"s));
+			delete clone;
+			Assert::AreEqual(3_z, ReactionDispatcher::ReactionCount("Hit"s));
+
+			// cleanup
+			Event<EventMessageAttributed>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(ReactionDeletesReactionTest)
+		{
+			ReactionAttributedFactory reactionsAttributedFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+			ActionDeleteFactory actionDeleteFactory;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::steady_clock::now());
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+			EventQueue eventQueue;
+
+			World world("TestWorld", eventQueue);
+			Entity* entity = world.CreateSector("TestSector"s)->CreateEntity("Entity"s, "TestEntity"s);
+
+			ReactionAttributed* reactions[3];
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				reactions[i] = entity->CreateAction("ReactionAttributed", "TestReaction"s + std::to_string(i))->As<ReactionAttributed>();
+				reactions[i]->SetSubtype("Hit"s);
+			}
+
+			// the first reaction deletes the second one, which was already handed the event
+			ActionDelete* deleter = reactions[0]->CreateAction("ActionDelete", "actionDelete")->As<ActionDelete>();
+			deleter->SetTarget(reactions[1]);
+			ActionIncrement* increment = reactions[2]->CreateAction("ActionIncrement", "actionIncrement")->As<ActionIncrement>();
+			(*increment)["Target"] = "Number";
+			(*increment)["Number"] = 0;
+			world.Update(worldState);
+
+			EventMessageAttributed message;
+			message.SetWorld(world);
+			message.SetSubType("Hit"s);
+			Event<EventMessageAttributed>(std::move(message)).Deliver();
+
+			// the deleted reaction is skipped, the ones after it still react
+			Assert::AreEqual(2_z, ReactionDispatcher::ReactionCount("Hit"s));
+			Assert::AreEqual(1, (*increment)["Number"].Get<std::int32_t>());
+
+			// cleanup
+			Event<EventMessageAttributed>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(RecycledReactionTest)
+		{
+			ReactionAttributedFactory reactionsAttributedFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::steady_clock::now());
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+			EventQueue eventQueue;
+
+			World world("TestWorld", eventQueue);
+			Entity* entity = world.CreateSector("TestSector"s)->CreateEntity("Entity"s, "TestEntity"s);
+
+			// a reaction without a subtype, the one a reset product would have
+			ReactionAttributed* reaction = entity->CreateAction("ReactionAttributed", "TestReaction"s)->As<ReactionAttributed>();
+			ActionIncrement* increment = reaction->CreateAction("ActionIncrement", "actionIncrement")->As<ActionIncrement>();
+			(*increment)["Target"] = "Number";
+			(*increment)["Number"] = 0;
+			world.Update(worldState);
+
+			auto send = [&eventQueue, &world]
+			{
+				EventMessageAttributed message;
+				message.SetWorld(world);
+				eventQueue.Send(std::make_shared<Event<EventMessageAttributed>>(std::move(message)));
+			};
+
+			send();
+			Assert::AreEqual(1, (*increment)["Number"].Get<std::int32_t>());
+			Assert::AreEqual(1_z, ReactionDispatcher::ReactionCount(std::string()));
+
+			// recycled reactions are deleted, not pooled where they would still be handed events
+			Scope* recycled = Factory<Scope>::Create("ReactionAttributed"s);
+			Assert::AreEqual(2_z, ReactionDispatcher::ReactionCount(std::string()));
+			Factory<Scope>::Recycle(recycled);
+			Assert::AreEqual(0_z, reactionsAttributedFactory.PoolSize());
+			Assert::AreEqual(1_z, ReactionDispatcher::ReactionCount(std::string()));
+
+			world.Bury(reaction);
+			world.Update(worldState);
+			Assert::AreEqual(0_z, reactionsAttributedFactory.PoolSize());
+			Assert::AreEqual(0_z, ReactionDispatcher::ReactionCount(std::string()));
+			send();
+
+			// cleanup
+			Event<EventMessageAttributed>::UnsubscribeAll();
+		}
+
+		TEST_METHOD(ArgumentsTest)
+		{
+			ReactionAttributedFactory reactionsAttributedFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::steady_clock::now());
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+			EventQueue eventQueue;
+
+			World world("TestWorld", eventQueue);
+			Entity* entity = world.CreateSector("TestSector"s)->CreateEntity("Entity"s, "TestEntity"s);
+
+			{
+				// a frame is a view of the message's own arguments, the prescribed attributes stay hidden
+				EventMessageAttributed message;
+				message.SetSubType("Hit"s);
+				message.AppendAuxiliaryAttribute("Target") = "Other"s;
+
+				CallFrame frame(message);
+				Assert::IsTrue(&frame.Arguments() == &message);
+				Assert::IsTrue(frame.Find(Symbol("Target")) == message.Find("Target"));
+				Assert::IsNull(frame.Find(Symbol("SubType")));
+				Assert::IsNull(frame.Find(Symbol("this")));
+				Assert::IsNull(frame.Find(Symbol("NotAnArgument")));
+			}
+
+			ReactionAttributed* reaction = entity->CreateAction("ReactionAttributed", "TestReaction"s)->As<ReactionAttributed>();
+			reaction->SetSubtype("Hit"s);
+			ActionIncrement* actionIncrement = reaction->CreateAction("ActionIncrement", "actionIncrement")->As<ActionIncrement>();
+			(*actionIncrement)["Target"] = "Number";
+			(*actionIncrement)["Number"] = 0;
+			(*actionIncrement)["Other"] = 0;
+			world.Update(worldState);
+
+			auto send = [&eventQueue, &world](const std::string& target)
+			{
+				EventMessageAttributed message;
+				message.SetWorld(world);
+				message.SetSubType("Hit"s);
+				if (!target.empty())
+				{
+					message.AppendAuxiliaryAttribute("Target") = target;
+				}
+				eventQueue.Send(std::make_shared<Event<EventMessageAttributed>>(std::move(message)));
+			};
+
+			{
+				// writing to an argument writes to the frame's copy, the message every reaction shares is left alone
+				EventMessageAttributed message;
+				message.SetWorld(world);
+				message.AppendAuxiliaryAttribute("Target") = "Other"s;
+
+				worldState.GetCallStack().Push(CallFrame(message));
+
+				// reading does not copy, the argument is the message's own
+				Assert::IsTrue(actionIncrement->FindArgument(Symbol("Target")) == message.Find("Target"));
+				Assert::IsTrue(actionIncrement->Find(Symbol("Target")) == &(*actionIncrement)["Target"]);
+
+				Datum* argument = actionIncrement->FindArgumentForWrite(Symbol("Target"));
+				Assert::IsNotNull(argument);
+				Assert::IsFalse(argument == message.Find("Target"));
+				argument->Set("Number"s);
+				Assert::IsTrue(argument == actionIncrement->FindArgumentForWrite(Symbol("Target")));
+				Assert::IsTrue(argument == actionIncrement->FindArgument(Symbol("Target")));
+				Assert::AreEqual("Number"s, worldState.GetCallStack().Top().Find(Symbol("Target"))->Get<std::string>());
+				Assert::AreEqual("Other"s, message["Target"].Get<std::string>());
+				worldState.GetCallStack().Pop();
+			}
+
+			// the argument shadows the action's own attribute while the reaction runs
+			send("Other"s);
+			Assert::AreEqual(0, (*actionIncrement)["Number"].Get<std::int32_t>());
+			Assert::AreEqual(1, (*actionIncrement)["Other"].Get<std::int32_t>());
+			Assert::IsTrue(worldState.GetCallStack().IsEmpty());
+
+			send(std::string());
+			Assert::AreEqual(1, (*actionIncrement)["Number"].Get<std::int32_t>());
+			Assert::AreEqual(1, (*actionIncrement)["Other"].Get<std::int32_t>());
+
+			// cleanup
+			Event<EventMessageAttributed>::UnsubscribeAll();
+		}
+
 		TEST_METHOD(ParsingFromFileTest)
 		{
 			SectorFactory sectorFactory;
@@ -385,6 +654,68 @@ namespace UnitTestLibraryDesktop
 		}
 
 
+		TEST_METHOD(ParsedSubtypeDispatchTest)
+		{
+			SectorFactory sectorFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+			ReactionAttributedFactory reactionAttributedFactory;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::steady_clock::now());
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+
+			// updated before it is loaded, only to give the reactions a world state to run on
+			World world;
+			world.Update(worldState);
+
+			JsonTableParseHelper tableParseHelper;
+			JsonTableParseHelper::SharedData tableSharedData(world);
+			JsonParseMaster parseMaster(tableSharedData);
+			parseMaster.AddHelper(tableParseHelper);
+			parseMaster.Initialize();
+			parseMaster.ParseFromFile("Content\\ReactionTest.json");
+
+			Sector* sector = world["Sectors"].Get<Scope*>(0)->As<Sector>();
+			Entity* entity = (*sector)["Entities"].Get<Scope*>(0)->As<Entity>();
+			ReactionAttributed* reaction = (*entity)["Actions"].Get<Scope*>(1)->As<ReactionAttributed>();
+			ActionIncrement* increment = (*reaction)["Actions"].Get<Scope*>(0)->As<ActionIncrement>();
+
+			auto deliver = [&world](const std::string& subtype)
+			{
+				EventMessageAttributed message;
+				message.SetWorld(world);
+				message.SetSubType(subtype);
+				Event<EventMessageAttributed>(std::move(message)).Deliver();
+			};
+
+			// the subtype the parser wrote is routed by before the reaction was ever updated
+			Assert::AreEqual(1_z, ReactionDispatcher::ReactionCount("integer"s));
+			deliver("integer"s);
+			Assert::AreEqual(2000, (*increment)["Number"].Get<std::int32_t>());
+
+			// a subtype changed through the datum is not reacted to under the old one, and is routed by from then on
+			(*reaction)["SubType"] = "float"s;
+			deliver("integer"s);
+			Assert::AreEqual(2000, (*increment)["Number"].Get<std::int32_t>());
+			Assert::AreEqual(0_z, ReactionDispatcher::ReactionCount("integer"s));
+			deliver("float"s);
+			Assert::AreEqual(2001, (*increment)["Number"].Get<std::int32_t>());
+
+			// unsubscribing every subscriber drops the dispatcher, the next reaction to register brings it back
+			Event<EventMessageAttributed>::UnsubscribeAll();
+			deliver("float"s);
+			Assert::AreEqual(2001, (*increment)["Number"].Get<std::int32_t>());
+			ReactionAttributed* other = entity->CreateAction("ReactionAttributed"s, "OtherReaction"s)->As<ReactionAttributed>();
+			Assert::IsNotNull(other);
+			deliver("float"s);
+			Assert::AreEqual(2002, (*increment)["Number"].Get<std::int32_t>());
+
+			// cleanup
+			Event<EventMessageAttributed>::UnsubscribeAll();
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
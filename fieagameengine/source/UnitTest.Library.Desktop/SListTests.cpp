@@ -379,6 +379,31 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(Foo(data2), list.Front());
 		}
 		
+		TEST_METHOD(SpliceFront)
+		{
+			SList<Foo> list;
+			SList<Foo> other;
+			Assert::ExpectException<std::runtime_error>([&list, &other] { list.SpliceFront(other); });
+
+			other.PushBack(Foo(10));
+			other.PushBack(Foo(20));
+			const Foo* address = &other.Front();
+
+			list.SpliceFront(other);
+			Assert::AreEqual(std::size_t(1), list.Size());
+			Assert::AreEqual(std::size_t(1), other.Size());
+			Assert::AreEqual(Foo(10), list.Front());
+			Assert::AreEqual(Foo(10), list.Back());
+			Assert::AreEqual(Foo(20), other.Back());
+			Assert::IsTrue(address == &list.Front());
+
+			list.SpliceFront(other);
+			Assert::AreEqual(std::size_t(2), list.Size());
+			Assert::IsTrue(other.IsEmpty());
+			Assert::AreEqual(Foo(20), list.Front());
+			Assert::AreEqual(Foo(10), list.Back());
+		}
+
 		TEST_METHOD(PopBack)
 		{
 			SList<Foo> list;
@@ -211,6 +211,36 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(SymbolKeys)
+		{
+			const Symbol hp("hp");
+			const Symbol name("name");
+
+			Scope s;
+			s.Append(hp) = 20;
+			s[name] = "hero1";
+			Assert::AreEqual(2_z, s.Size());
+
+			// string and Symbol keys refer to the same entries
+			Assert::IsTrue(s.Find(hp) == s.Find("hp"));
+			Assert::AreEqual("hero1"s, s.Find("name")->Get<std::string>());
+			Assert::AreEqual(&s.Append("hp"), &s.Append(hp));
+
+			// never interned, so it cannot be a key in any scope
+			Assert::IsFalse(Symbol::TryFind("neverInternedKey").IsValid());
+			Assert::IsNull(s.Find("neverInternedKey"));
+			Assert::IsNull(s.Search("neverInternedKey"));
+			Assert::ExpectException<std::runtime_error>([&s] { s.Append(Symbol()); });
+
+			Scope& child = s.AppendScope(Symbol("child"));
+			Scope* foundScope = nullptr;
+			Assert::AreEqual(20, child.Search(hp, foundScope)->Get<std::int32_t>());
+			Assert::IsTrue(foundScope == &s);
+
+			const Scope& constScope = s;
+			Assert::AreEqual(20, constScope.Find(hp)->Get<std::int32_t>());
+		}
+
 
 #pragma endregion Scope Tests
 
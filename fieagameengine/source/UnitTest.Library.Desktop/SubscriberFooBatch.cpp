@@ -0,0 +1,50 @@
+#include "pch.h"
+#include "SubscriberFooBatch.h"
+#include "Event.h"
+#include "Foo.h"
+#include "Bar.h"
+
+namespace Library
+{
+	std::size_t SubscriberFooBatch::BatchCount() const
+	{
+		return mBatchCount;
+	}
+
+	const Vector<std::int32_t>& SubscriberFooBatch::FooValues() const
+	{
+		return mFooValues;
+	}
+
+	const Vector<std::int32_t>& SubscriberFooBatch::BarValues() const
+	{
+		return mBarValues;
+	}
+
+	void SubscriberFooBatch::Notify(const IEventPublisher& event)
+	{
+		const IEventPublisher* events = &event;
+		NotifyBatch(&events, 1);
+	}
+
+	void SubscriberFooBatch::NotifyBatch(const IEventPublisher* const* events, std::size_t count)
+	{
+		++mBatchCount;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Event<Foo>* foo = events[i]->As<Event<Foo>>();
+			if (foo)
+			{
+				mFooValues.PushBack(foo->Message().Data());
+			}
+
+			const Event<Bar>* bar = events[i]->As<Event<Bar>>();
+			if (bar)
+			{
+				mBarValues.PushBack(bar->Message().Data());
+			}
+		}
+	}
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "IEventSubscriber.h"
+#include "IEventPublisher.h"
+#include "Vector.h"
+
+namespace Library
+{
+	class SubscriberFooBatch final : public IEventSubscriber
+	{
+	public:
+		SubscriberFooBatch() = default;
+		SubscriberFooBatch(const SubscriberFooBatch& rhs) = default;
+		SubscriberFooBatch(SubscriberFooBatch&& rhs) = default;
+		SubscriberFooBatch& operator=(const SubscriberFooBatch& rhs) = default;
+		SubscriberFooBatch& operator=(SubscriberFooBatch&& rhs) = default;
+		~SubscriberFooBatch() = default;
+
+		std::size_t BatchCount() const;
+		const Vector<std::int32_t>& FooValues() const;
+		const Vector<std::int32_t>& BarValues() const;
+		virtual void Notify(const IEventPublisher& event) override;
+		virtual void NotifyBatch(const IEventPublisher* const* events, std::size_t count) override;
+
+	private:
+		std::size_t mBatchCount{ 0 };
+		Vector<std::int32_t> mFooValues;
+		Vector<std::int32_t> mBarValues;
+	};
+
+
+}
@@ -0,0 +1,31 @@
+#include "pch.h"
+#include "SubscriberFooThrow.h"
+#include "Event.h"
+#include "Foo.h"
+
+namespace Library
+{
+	void SubscriberFooThrow::SetThrows(bool throws)
+	{
+		mThrows = throws;
+	}
+
+	std::size_t SubscriberFooThrow::NotifyCount() const
+	{
+		return mNotifyCount;
+	}
+
+	void SubscriberFooThrow::Notify(const IEventPublisher& event)
+	{
+		const Event<Foo>* foo = event.As<Event<Foo>>();
+		if (foo)
+		{
+			++mNotifyCount;
+			if (mThrows)
+			{
+				throw std::runtime_error("SubscriberFooThrow was notified");
+			}
+		}
+	}
+
+}
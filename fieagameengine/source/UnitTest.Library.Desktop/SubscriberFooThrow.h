@@ -0,0 +1,27 @@
+#pragma once
+#include "IEventSubscriber.h"
+#include "IEventPublisher.h"
+
+namespace Library
+{
+	class SubscriberFooThrow final : public IEventSubscriber
+	{
+	public:
+		SubscriberFooThrow() = default;
+		SubscriberFooThrow(const SubscriberFooThrow& rhs) = default;
+		SubscriberFooThrow(SubscriberFooThrow&& rhs) = default;
+		SubscriberFooThrow& operator=(const SubscriberFooThrow& rhs) = default;
+		SubscriberFooThrow& operator=(SubscriberFooThrow&& rhs) = default;
+		~SubscriberFooThrow() = default;
+
+		void SetThrows(bool throws);
+		std::size_t NotifyCount() const;
+		virtual void Notify(const IEventPublisher& event) override;
+
+	private:
+		std::size_t mNotifyCount{ 0 };
+		bool mThrows{ true };
+	};
+
+
+}
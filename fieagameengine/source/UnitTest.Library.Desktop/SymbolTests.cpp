@@ -0,0 +1,108 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Symbol.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SymbolTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			Symbol invalid;
+			Assert::IsFalse(invalid.IsValid());
+			Assert::AreEqual(0_z, invalid.Id());
+			Assert::IsTrue(invalid.Name().empty());
+
+			Symbol a("SymbolTests.Constructor");
+			Symbol b("SymbolTests.Constructor"s);
+			Assert::IsTrue(a.IsValid());
+			Assert::AreNotEqual(0_z, a.Id());
+			Assert::IsTrue(a == b);
+			Assert::IsTrue(a != invalid);
+		}
+
+		TEST_METHOD(Intern)
+		{
+			Symbol a = Symbol::Intern("SymbolTests.Intern.A");
+			size_t count = Symbol::Count();
+
+			// interning an existing string hands back the same entry
+			Symbol again = Symbol::Intern("SymbolTests.Intern.A");
+			Assert::AreEqual(a.Id(), again.Id());
+			Assert::IsTrue(a.Name().data() == again.Name().data());
+			Assert::AreEqual(count, Symbol::Count());
+
+			Symbol b = Symbol::Intern("SymbolTests.Intern.B");
+			Assert::AreNotEqual(a.Id(), b.Id());
+			Assert::AreEqual(count + 1, Symbol::Count());
+
+			// names stay put as the table and its character blocks grow, long names get a block of their own
+			const char* name = a.Name().data();
+			for (int i = 0; i < 2000; ++i)
+			{
+				Symbol::Intern("SymbolTests.Intern." + std::to_string(i));
+			}
+			const std::string longName(5000, 'L');
+			Symbol l = Symbol::Intern(longName);
+			Assert::IsTrue(name == Symbol::Intern("SymbolTests.Intern.A").Name().data());
+			Assert::AreEqual("SymbolTests.Intern.A"s, std::string(a.Name()));
+			Assert::AreEqual("SymbolTests.Intern.1999"s, std::string(Symbol::Intern("SymbolTests.Intern.1999").Name()));
+			Assert::AreEqual(longName, std::string(l.Name()));
+		}
+
+		TEST_METHOD(TryFind)
+		{
+			Assert::IsFalse(Symbol::TryFind("SymbolTests.TryFind").IsValid());
+			size_t count = Symbol::Count();
+			Assert::IsFalse(Symbol::TryFind("SymbolTests.TryFind").IsValid());
+			Assert::AreEqual(count, Symbol::Count());
+
+			Symbol a("SymbolTests.TryFind");
+			Assert::IsTrue(a == Symbol::TryFind("SymbolTests.TryFind"));
+		}
+
+		TEST_METHOD(StringConversion)
+		{
+			Symbol a("SymbolTests.StringConversion");
+			std::string_view name = a;
+			Assert::AreEqual("SymbolTests.StringConversion"s, std::string(name));
+			Assert::IsTrue(a.Name().data() == name.data());
+			Assert::AreEqual('\0', name.data()[name.size()]);
+
+			DefaultHash<Symbol> hash;
+			Assert::AreEqual(a.Id(), hash(a));
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState SymbolTests::sStartMemState;
+}
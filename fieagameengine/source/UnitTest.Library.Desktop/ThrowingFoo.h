@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Foo.h"
+#include "Factory.h"
+#include <stdexcept>
+
+namespace Library
+{
+	/// <summary>
+	/// Foo whose default constructor throws while Throws is set, a product that cannot be reset
+	/// </summary>
+	class ThrowingFoo final : public Foo
+	{
+	public:
+		ThrowingFoo()
+		{
+			if (Throws)
+			{
+				throw std::runtime_error("ThrowingFoo cannot be constructed");
+			}
+		}
+
+		inline static bool Throws = false;
+	};
+
+	ConcreteFactory(ThrowingFoo, RTTI)
+}
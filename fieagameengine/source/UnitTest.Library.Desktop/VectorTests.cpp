@@ -2,6 +2,7 @@
 #include "CppUnitTest.h"
 #include "vector.h"
 #include "Foo.h"
+#include <chrono>
 #include <gsl/gsl>
 #include <glm/glm.hpp>
 
@@ -572,7 +573,7 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::runtime_error>([&fooList] { fooList.Front(); });
 			Assert::ExpectException<std::runtime_error>([&fooList] { fooList.Back(); });
 
-			Vector<Foo> ListIncrement(10, [](const size_t, const size_t) { return 100; });
+			RuntimeVector<Foo> ListIncrement(10, [](const size_t, const size_t) { return 100; });
 			Assert::IsTrue(ListIncrement.IsEmpty());
 			Assert::AreEqual(0_z, ListIncrement.Size());
 			Assert::AreEqual(10_z, ListIncrement.Capacity());
@@ -1222,6 +1223,34 @@ namespace UnitTestLibraryDesktop
 
 		}
 
+		TEST_METHOD(FunctorPolicyBenchmark)
+		{
+			// starting at capacity 1 and doubling, so the growth functor is consulted on every reallocation
+			const auto measure = [](auto&& list)
+			{
+				const auto start = std::chrono::high_resolution_clock::now();
+				for (int pass = 0; pass < 100; ++pass)
+				{
+					list.Clear();
+					list.ShrinkToFit();
+					for (int i = 0; i < 10000; ++i)
+					{
+						list.PushBack(i);
+					}
+				}
+				const auto end = std::chrono::high_resolution_clock::now();
+				return std::pair<size_t, long long>(list.Capacity(), std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+			};
+
+			const auto [inlinedCapacity, inlinedTime] = measure(Vector<int>());
+			const auto [erasedCapacity, erasedTime] = measure(RuntimeVector<int>());
+
+			Logger::WriteMessage(("Vector PushBack:        " + std::to_string(inlinedTime) + "us\n").c_str());
+			Logger::WriteMessage(("RuntimeVector PushBack: " + std::to_string(erasedTime) + "us\n").c_str());
+
+			Assert::AreEqual(inlinedCapacity, erasedCapacity);
+		}
+
 #pragma endregion Vector Tests
 
 
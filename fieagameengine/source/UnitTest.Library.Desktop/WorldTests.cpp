@@ -9,6 +9,19 @@
 #include <fstream>
 #include "Foo.h"
 #include "DerivedFoo.h"
+#include "JobSystem.h"
+#include "ActionIncrement.h"
+#include "ActionDestroyAction.h"
+#include "ActionRecord.h"
+#include "ActionCreateAction.h"
+#include "ActionEmit.h"
+#include "Particle.h"
+#include "ActionBatcher.h"
+#include "ScopeCooker.h"
+#include "JsonParallelLoader.h"
+#include <sstream>
+#include <chrono>
+#include <cstdio>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -52,6 +65,13 @@ namespace UnitTestLibraryDesktop
 			TypeManager::RegisterType(Entity::TypeIdClass(), Entity::Signatures());
 			TypeManager::RegisterType(Sector::TypeIdClass(), Sector::Signatures());
 			TypeManager::RegisterType(World::TypeIdClass(), World::Signatures());
+			TypeManager::RegisterType(Action::TypeIdClass(), Action::Signatures());
+			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures());
+			TypeManager::RegisterType(ActionDestroyAction::TypeIdClass(), ActionDestroyAction::Signatures());
+			TypeManager::RegisterType(ActionRecord::TypeIdClass(), ActionRecord::Signatures());
+			TypeManager::RegisterType(ActionCreateAction::TypeIdClass(), ActionCreateAction::Signatures());
+			TypeManager::RegisterType(ActionEmit::TypeIdClass(), ActionEmit::Signatures());
+			TypeManager::RegisterType(Particle::TypeIdClass(), Particle::Signatures());
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -163,6 +183,284 @@ namespace UnitTestLibraryDesktop
 			world.Update(worldState);
 		}
 
+		TEST_METHOD(ParallelUpdateTest)
+		{
+			SectorFactory sectorFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+			ActionDestroyActionFactory actionDestroyActionFactory;
+
+			const size_t sectorCount = 8;
+			const size_t entityCount = 16;
+
+			World world("TestWorld");
+			for (size_t i = 0; i < sectorCount; ++i)
+			{
+				Sector* sector = world.CreateSector("Sector" + to_string(i));
+				for (size_t j = 0; j < entityCount; ++j)
+				{
+					Entity* entity = sector->CreateEntity("Entity", "Entity" + to_string(j));
+					(*entity)["Count"] = 0;
+
+					Action* increment = entity->CreateAction("ActionIncrement", "Increment");
+					(*increment)["Target"] = "Count";
+
+					// during the first update every entity buries one of its actions and the destroy action itself, so Bury is hit from every job
+					ActionDestroyAction* destroy = entity->CreateAction("ActionDestroyAction", "Destroy")->As<ActionDestroyAction>();
+					destroy->SetActionInstanceName("Doomed");
+					entity->CreateAction("ActionIncrement", "Doomed");
+				}
+			}
+
+			GameTime gameTime;
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+
+			JobSystem jobSystem(3);
+			Assert::AreEqual(4_z, jobSystem.SlotCount());
+			world.SetJobSystem(&jobSystem);
+			Assert::IsTrue(&jobSystem == world.GetJobSystem());
+			Assert::IsTrue(World::UpdateMode::ParallelSectors == world.GetUpdateMode());
+
+			world.Update(worldState);
+			Assert::IsTrue(world.GetGraveyard().IsEmpty());
+			Assert::IsNull(worldState.sector);
+
+			world.SetJobSystem(&jobSystem, World::UpdateMode::ParallelEntities);
+			world.Update(worldState);
+
+			world.SetJobSystem(nullptr);
+			Assert::IsTrue(World::UpdateMode::Serial == world.GetUpdateMode());
+			world.Update(worldState);
+
+			Datum& sectors = world.Sectors();
+			for (size_t i = 0; i < sectorCount; ++i)
+			{
+				Datum& entities = sectors.Get<Scope*>(i)->As<Sector>()->Entities();
+				Assert::AreEqual(entityCount, entities.Size());
+				for (size_t j = 0; j < entityCount; ++j)
+				{
+					Entity* entity = entities.Get<Scope*>(j)->As<Entity>();
+					Assert::AreEqual(3, (*entity)["Count"].Get<std::int32_t>());
+					Assert::AreEqual(1_z, entity->Actions().Size());
+				}
+			}
+		}
+
+		TEST_METHOD(ParallelSpawnTest)
+		{
+			SectorFactory sectorFactory;
+			ParticleFactory particleFactory;
+			ActionEmitFactory actionEmitFactory;
+			ActionCreateActionFactory actionCreateActionFactory;
+			ActionIncrementFactory actionIncrementFactory;
+			AttributePool& pool = TypeManager::GetPool(Particle::TypeIdClass());
+
+			const size_t sectorCount = 4;
+			const size_t emitterCount = 16;
+			{
+				World world("TestWorld");
+				for (size_t i = 0; i < sectorCount; ++i)
+				{
+					Sector* sector = world.CreateSector("Sector" + to_string(i));
+					for (size_t j = 0; j < emitterCount; ++j)
+					{
+						Entity* emitter = sector->CreateEntity("Particle", "Emitter" + to_string(j));
+						(*emitter)["Velocity"] = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+						emitter->CreateAction("ActionEmit", "Emit");
+
+						ActionCreateAction* create = emitter->CreateAction("ActionCreateAction", "Create")->As<ActionCreateAction>();
+						create->SetClassName("ActionIncrement");
+						create->SetInstanceName("Created");
+					}
+				}
+				Assert::AreEqual(sectorCount * emitterCount, pool.Size());
+
+				GameTime gameTime;
+				WorldState worldState;
+				worldState.SetGameTime(gameTime);
+
+				// every emitter writes its pooled position while the others spawn particles, which would grow the pool under them
+				JobSystem jobSystem(3);
+				world.SetJobSystem(&jobSystem, World::UpdateMode::ParallelEntities);
+				world.Update(worldState);
+				Assert::IsFalse(world.IsUpdatingInParallel());
+
+				world.SetJobSystem(&jobSystem, World::UpdateMode::ParallelSectors);
+				world.Update(worldState);
+
+				// spawned after the jobs, the first update's particles are not emitters and the actions created did not run
+				Assert::AreEqual(sectorCount * emitterCount * 3, pool.Size());
+				Datum& sectors = world.Sectors();
+				for (size_t i = 0; i < sectorCount; ++i)
+				{
+					Datum& entities = sectors.Get<Scope*>(i)->As<Sector>()->Entities();
+					Assert::AreEqual(emitterCount * 3, entities.Size());
+					for (size_t j = 0; j < entities.Size(); ++j)
+					{
+						Entity* entity = entities.Get<Scope*>(j)->As<Entity>();
+						Assert::IsTrue(entity->Is<Particle>());
+						if (j < emitterCount)
+						{
+							Assert::AreEqual(4_z, entity->Actions().Size());
+							Assert::IsTrue(glm::vec4(2.0f, 0.0f, 0.0f, 0.0f) == (*entity)["Position"].Get<glm::vec4>());
+						}
+						else
+						{
+							Assert::AreEqual("Emitted"s, entity->Name());
+							Assert::AreEqual(0_z, entity->Actions().Size());
+							Assert::IsTrue(glm::vec4(0.0f) == (*entity)["Position"].Get<glm::vec4>());
+						}
+					}
+				}
+
+				const size_t position = pool.ColumnIndex(Symbol("Position"));
+				const glm::vec4* positions = pool.Column<glm::vec4>(position);
+				for (size_t row = 0; row < pool.Size(); ++row)
+				{
+					Assert::IsTrue(&pool.Owner(row)["Position"].Get<glm::vec4>() == positions + row);
+				}
+			}
+			Assert::IsTrue(pool.IsEmpty());
+		}
+
+		TEST_METHOD(BuryTest)
+		{
+			SectorFactory sectorFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			World world("TestWorld");
+			Sector* sector = world.CreateSector("TestSector");
+			Entity* doomed = sector->CreateEntity("Entity", "Doomed");
+			(*doomed)["Count"] = 0;
+			Action* child = doomed->CreateAction("ActionIncrement", "Child");
+			(*child)["Target"] = "Count";
+			Entity* survivor = sector->CreateEntity("Entity", "Survivor");
+
+			// burying twice, or a descendant before its ancestor, destroys the subtree once
+			world.Bury(child);
+			world.Bury(doomed);
+			world.Bury(doomed);
+			world.Bury(child);
+			Assert::AreEqual(2_z, world.GetGraveyard().Size());
+
+			GameTime gameTime;
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+
+			world.Update(worldState);
+			Assert::IsTrue(world.GetGraveyard().IsEmpty());
+			Assert::AreEqual(1_z, sector->Entities().Size());
+			Assert::IsTrue(sector->Entities().Get<Scope*>(0) == survivor);
+			Assert::AreEqual(1_z, entityFactory.PoolSize());
+		}
+
+		TEST_METHOD(BuryManyTest)
+		{
+			World world("TestWorld");
+			Vector<Scope*> buried;
+			buried.Reserve(100000);
+			for (std::size_t group = 0; group < 1000; ++group)
+			{
+				Scope& members = world.AppendScope("Groups");
+				for (std::size_t member = 0; member < 100; ++member)
+				{
+					buried.PushBack(&members.AppendScope("Members"));
+				}
+			}
+
+			// each check is a walk up the scope's ancestors, however many scopes are buried already
+			const auto start = std::chrono::steady_clock::now();
+			for (Scope* scope : buried)
+			{
+				world.Bury(scope);
+			}
+			for (Scope* scope : buried)
+			{
+				world.Bury(scope);
+			}
+			const auto elapsed = std::chrono::steady_clock::now() - start;
+			Assert::IsTrue(elapsed < std::chrono::seconds(1));
+			Assert::AreEqual(100000_z, world.GetGraveyard().Size());
+
+			GameTime gameTime;
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+
+			world.Update(worldState);
+			Assert::IsTrue(world.GetGraveyard().IsEmpty());
+			Assert::AreEqual(1000_z, world["Groups"].Size());
+			Assert::AreEqual(0_z, world["Groups"][999]["Members"].Size());
+		}
+
+		TEST_METHOD(BatchedActionsTest)
+		{
+			SectorFactory sectorFactory;
+			EntityFactory entityFactory;
+			ActionIncrementFactory actionIncrementFactory;
+			ActionRecordFactory actionRecordFactory;
+
+			World world("TestWorld");
+			Sector* sector = world.CreateSector("TestSector");
+			for (size_t i = 0; i < 3; ++i)
+			{
+				Entity* entity = sector->CreateEntity("Entity", "Entity" + to_string(i));
+				(*entity)["Count"] = 0;
+				entity->CreateAction("ActionRecord", "Record");
+				Action* increment = entity->CreateAction("ActionIncrement", "Increment");
+				(*increment)["Target"] = "Count";
+			}
+
+			Assert::ExpectException<std::runtime_error>([&world] { world.SetUpdateMode(World::UpdateMode::ParallelSectors); });
+			world.SetUpdateMode(World::UpdateMode::BatchedActions);
+			Assert::IsTrue(World::UpdateMode::BatchedActions == world.GetUpdateMode());
+
+			// batching needs no job system, it is kept without one
+			world.SetJobSystem(nullptr, World::UpdateMode::BatchedActions);
+			Assert::IsTrue(World::UpdateMode::BatchedActions == world.GetUpdateMode());
+			world.SetJobSystem(nullptr, World::UpdateMode::ParallelEntities);
+			Assert::IsTrue(World::UpdateMode::Serial == world.GetUpdateMode());
+			world.SetJobSystem(nullptr, World::UpdateMode::BatchedActions);
+
+			// increments go through the registered batch, records through virtual calls
+			ActionBatcher::RegisterBatch<ActionIncrement>();
+
+			GameTime gameTime;
+			WorldState worldState;
+			worldState.SetGameTime(gameTime);
+
+			// groups run in the order their types first appear, every record before any increment
+			world.Update(worldState);
+			Datum& log = (*sector)["Log"];
+			Assert::AreEqual(3_z, log.Size());
+			for (size_t i = 0; i < 3; ++i)
+			{
+				Assert::AreEqual("Entity" + to_string(i) + ":0", log.Get<std::string>(i));
+				Assert::AreEqual(1, sector->Entities()[i]["Count"].Get<std::int32_t>());
+			}
+			Assert::IsNull(worldState.entity);
+			Assert::IsNull(worldState.action);
+
+			// a declared order wins over the order of appearance
+			ActionBatcher::DeclareOrder(ActionIncrement::TypeIdClass(), ActionRecord::TypeIdClass());
+			world.Update(worldState);
+			Assert::AreEqual(6_z, log.Size());
+			for (size_t i = 0; i < 3; ++i)
+			{
+				Assert::AreEqual("Entity" + to_string(i) + ":2", log.Get<std::string>(i + 3));
+			}
+
+			ActionBatcher::DeclareOrder(ActionRecord::TypeIdClass(), ActionIncrement::TypeIdClass());
+			Assert::ExpectException<std::runtime_error>([&world, &worldState] { world.Update(worldState); });
+			ActionBatcher::Clear();
+
+			// nothing is left over from the update that threw
+			world.Update(worldState);
+			Assert::AreEqual(9_z, log.Size());
+			Assert::AreEqual("Entity0:2"s, log.Get<std::string>(6));
+		}
+
 		TEST_METHOD(ParsingFromFileTest)
 		{
 			SectorFactory sectorFactory;
@@ -206,6 +504,179 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual("Entity2-1"s, entity2_1->Name());
 			Assert::AreEqual("Entity2-1"s, (*entity2_1)["Name"].Get<std::string>());
 		}
+
+		TEST_METHOD(CookedWorldTest)
+		{
+			SectorFactory sectorFactory;
+			EntityFactory entityfactory;
+
+			JsonTableParseHelper tableParseHelper;
+			World world;
+			JsonTableParseHelper::SharedData tableSharedData(world);
+			JsonParseMaster parseMaster(tableSharedData);
+			parseMaster.AddHelper(tableParseHelper);
+			parseMaster.Initialize();
+			parseMaster.ParseFromFile("Content\\WorldTest.json");
+
+			// types the file does not use go through the raw arrays as well
+			world["Floats"].PushBack(1.5f);
+			world["Floats"].PushBack(-2.0f);
+			world["Vectors"].PushBack(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+			world["Matrix"].PushBack(glm::mat4(2.0f));
+			world.AppendScope("Plain")["X"] = 7;
+
+			std::stringstream image(std::ios::in | std::ios::out | std::ios::binary);
+			ScopeCooker::Cook(world, image);
+			const std::string bytes = image.str();
+
+			World loaded;
+			ScopeCooker::Load(bytes, loaded);
+
+			Assert::AreEqual(world.Size(), loaded.Size());
+			Assert::AreEqual(123, loaded["A"].Get<std::int32_t>());
+			Assert::AreEqual("World"s, loaded.Name());
+			Assert::AreEqual(-2.0f, loaded["Floats"].Get<std::float_t>(1));
+			Assert::IsTrue(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f) == loaded["Vectors"].Get<glm::vec4>());
+			Assert::IsTrue(glm::mat4(2.0f) == loaded["Matrix"].Get<glm::mat4>());
+
+			Scope& plain = loaded["Plain"][0];
+			Assert::AreEqual(Scope::TypeIdClass(), plain.TypeIdInstance());
+			Assert::AreEqual(7, plain["X"].Get<std::int32_t>());
+
+			Assert::AreEqual(world["Sectors"].Size(), loaded["Sectors"].Size());
+			Sector* sector1 = loaded["Sectors"][0].As<Sector>();
+			Assert::IsNotNull(sector1);
+			Assert::AreEqual("Sector1"s, sector1->Name());
+			Assert::AreEqual(2_z, (*sector1)["Entities"].Size());
+
+			Entity* entity1_2 = (*sector1)["Entities"][1].As<Entity>();
+			Assert::IsNotNull(entity1_2);
+			Assert::AreEqual("Entity1-2"s, entity1_2->Name());
+			Assert::AreEqual(123, (*entity1_2)["A"].Get<std::int32_t>());
+			Assert::AreEqual(static_cast<Scope*>(sector1), entity1_2->GetParent());
+
+			Sector* sector2 = loaded["Sectors"][1].As<Sector>();
+			Assert::IsNotNull(sector2);
+			Assert::AreEqual("Entity2-1"s, (*sector2)["Entities"][0].As<Entity>()->Name());
+
+			// through a file
+			const std::string fileName = "WorldTest.cooked";
+			ScopeCooker::CookToFile(world, fileName);
+			World fromFile;
+			ScopeCooker::LoadFromFile(fileName, fromFile);
+			Assert::AreEqual(world.Size(), fromFile.Size());
+			Assert::AreEqual("Sector2"s, fromFile["Sectors"][1].As<Sector>()->Name());
+			std::remove(fileName.c_str());
+
+			// into an arena: the new plain scopes and the attributes the load adds come from it,
+			// the root's own attributes and the scopes their factories make do not
+			{
+				Arena arena;
+				World inArena;
+				ScopeCooker::Load(bytes, inArena, &arena);
+				Assert::AreEqual(world.Size(), inArena.Size());
+				Assert::AreEqual(123, inArena["A"].Get<std::int32_t>());
+				Assert::IsFalse(arena.Owns(&inArena["A"].Get<std::int32_t>()));
+
+				Sector* arenaSector = inArena["Sectors"][0].As<Sector>();
+				Assert::IsNotNull(arenaSector);
+				Assert::IsFalse(arena.Owns(arenaSector));
+				Assert::AreEqual("Sector1"s, arenaSector->Name());
+
+				Entity* arenaEntity = (*arenaSector)["Entities"][1].As<Entity>();
+				Assert::IsFalse(arena.Owns(arenaEntity));
+				Assert::IsTrue(arena.Owns(&(*arenaEntity)["A"].Get<std::int32_t>()));
+				Assert::AreEqual(123, (*arenaEntity)["A"].Get<std::int32_t>());
+				Assert::IsTrue(arena.Owns(&inArena["Plain"][0]));
+				Assert::AreEqual(7, inArena["Plain"][0]["X"].Get<std::int32_t>());
+			}
+
+			World broken;
+			Assert::ExpectException<std::runtime_error>([&broken, &bytes] { ScopeCooker::Load(std::string_view(bytes).substr(0, bytes.size() - 1), broken); });
+			Assert::ExpectException<std::runtime_error>([&broken] { ScopeCooker::Load("not a cooked image", broken); });
+
+			// a scope no factory can make again cannot be cooked
+			Scope orphans;
+			orphans.Adopt(*new ActionRecord(), "Action");
+			Assert::ExpectException<std::runtime_error>([&orphans, &image] { ScopeCooker::Cook(orphans, image); });
+		}
+
+		TEST_METHOD(ParallelLoadTest)
+		{
+			SectorFactory sectorFactory;
+			EntityFactory entityfactory;
+
+			// a world split into one file per sector
+			const std::size_t fileCount = 12;
+			Vector<std::string> fileNames;
+			for (std::size_t i = 0; i < fileCount; ++i)
+			{
+				const std::string index = std::to_string(i);
+				fileNames.PushBack("WorldPart" + index + ".json");
+				std::ofstream file(fileNames.Back());
+				file << R"({ "Name": { "type": "string", "value": "World)" << index << R"(" },
+					"Sectors": { "type": "table", "value": [ { "class": "Sector", "type": "table", "value": {
+						"Name": { "type": "string", "value": "Sector)" << index << R"(" },
+						"Entities": { "type": "table", "value": [ { "class": "Entity", "type": "table", "value": {
+							"Name": { "type": "string", "value": "Entity)" << index << R"(" },
+							"A": { "type": "integer", "value": )" << i << R"( } } } ] } } } ] } })";
+			}
+
+			JsonTableParseHelper tableParseHelper;
+			World unused;
+			JsonTableParseHelper::SharedData tableSharedData(unused);
+			JsonParseMaster parseMaster(tableSharedData);
+			parseMaster.AddHelper(tableParseHelper);
+
+			JobSystem jobSystem(3);
+			World world;
+			JsonParallelLoader::LoadFiles(parseMaster, fileNames, world, &jobSystem);
+
+			// merged in the order the files are listed, whichever finished first
+			Assert::AreEqual(fileCount, world.Sectors().Size());
+			Assert::AreEqual("World11"s, world.Name());
+			for (std::size_t i = 0; i < fileCount; ++i)
+			{
+				Sector* sector = world.Sectors()[i].As<Sector>();
+				Assert::IsNotNull(sector);
+				Assert::AreEqual("Sector" + std::to_string(i), sector->Name());
+				Assert::AreEqual(static_cast<Scope*>(&world), sector->GetParent());
+
+				Entity* entity = (*sector)["Entities"][0].As<Entity>();
+				Assert::IsNotNull(entity);
+				Assert::AreEqual("Entity" + std::to_string(i), entity->Name());
+				Assert::AreEqual(static_cast<std::int32_t>(i), (*entity)["A"].Get<std::int32_t>());
+			}
+			Assert::IsTrue(unused.Sectors().IsEmpty());
+
+			World serial;
+			JsonParallelLoader::LoadFiles(parseMaster, fileNames, serial);
+			Assert::IsTrue(world == serial);
+
+			// a file that fails leaves the target as it was
+			fileNames.PushBack("Content\\Missing.json");
+			World failed;
+			Assert::ExpectException<std::runtime_error>([&parseMaster, &fileNames, &failed, &jobSystem] { JsonParallelLoader::LoadFiles(parseMaster, fileNames, failed, &jobSystem); });
+			Assert::IsTrue(failed.Sectors().IsEmpty());
+
+			// so does a file whose values do not fit it, even when it is listed after files that do
+			fileNames.PopBack();
+			fileNames.PushBack("WorldPartMistyped.json");
+			{
+				std::ofstream file(fileNames.Back());
+				file << R"({ "Name": { "type": "integer", "value": 1 } })";
+			}
+			World mistyped("Mistyped");
+			Assert::ExpectException<std::runtime_error>([&parseMaster, &fileNames, &mistyped, &jobSystem] { JsonParallelLoader::LoadFiles(parseMaster, fileNames, mistyped, &jobSystem); });
+			Assert::IsTrue(mistyped.Sectors().IsEmpty());
+			Assert::AreEqual("Mistyped"s, mistyped.Name());
+
+			for (const std::string& fileName : fileNames)
+			{
+				std::remove(fileName.c_str());
+			}
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};